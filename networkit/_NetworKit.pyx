@@ -13,6 +13,11 @@ try:
 except:
 	print(""" WARNING: module 'pandas' not found, some functionality will be restricted """)
 
+try:
+	import numpy
+except:
+	print(""" WARNING: module 'numpy' not found, some functionality will be restricted """)
+
 
 # C++ operators
 from cython.operator import dereference, preincrement
@@ -21,6 +26,9 @@ from cython.operator import dereference, preincrement
 from libc.stdint cimport uint64_t
 from libc.stdint cimport int64_t
 
+# the Python buffer protocol
+from cpython.buffer cimport PyBUF_WRITABLE
+
 # the C++ standard library
 from libcpp cimport bool
 from libcpp.vector cimport vector
@@ -55,6 +63,7 @@ cdef extern from "<algorithm>" namespace "std":
 	vector[double] move(vector[double])
 	vector[bool] move(vector[bool])
 	vector[count] move(vector[count])
+	vector[node] move(vector[node]) nogil
 	pair[_Graph, vector[node]] move(pair[_Graph, vector[node]]) nogil
 	vector[pair[pair[node, node], double]] move(vector[pair[pair[node, node], double]]) nogil
 	vector[pair[node, node]] move(vector[pair[node, node]]) nogil
@@ -78,6 +87,67 @@ def pystring(stdstring):
 	return stdstring.decode("utf-8")
 
 
+cdef class _ContiguousBuffer:
+	""" Exposes contiguous C++ storage through the buffer protocol, so that NumPy arrays can use it
+	without copying. Subclasses either own the storage or keep its owner alive. """
+	cdef const char* data
+	cdef Py_ssize_t shape[2]
+	cdef Py_ssize_t strides[2]
+	cdef int ndim
+	cdef Py_ssize_t itemsize
+	cdef bytes format
+	cdef bool readonly
+
+	cdef setStorage(self, const void* data, Py_ssize_t rows, Py_ssize_t columns, Py_ssize_t itemsize, bytes format, bool readonly):
+		""" Exposes `rows` x `columns` items stored row by row, a single column is exposed as a vector.
+		Storage that C++ only hands out as const has to be exposed read-only. """
+		self.data = <const char*>data
+		self.ndim = 1 if columns == 1 else 2
+		self.shape[0] = rows
+		self.shape[1] = columns
+		self.strides[0] = columns * itemsize
+		self.strides[1] = itemsize
+		self.itemsize = itemsize
+		self.format = format
+		self.readonly = readonly
+
+	def __getbuffer__(self, Py_buffer* buffer, int flags):
+		if self.readonly and (flags & PyBUF_WRITABLE) == PyBUF_WRITABLE:
+			raise BufferError("The buffer is read-only")
+		buffer.buf = <void*>self.data # writes are only requested if the buffer is not read-only
+		buffer.format = self.format
+		buffer.internal = NULL
+		buffer.itemsize = self.itemsize
+		buffer.len = self.shape[0] * self.strides[0]
+		buffer.ndim = self.ndim
+		buffer.obj = self
+		buffer.readonly = self.readonly
+		buffer.shape = self.shape
+		buffer.strides = self.strides
+		buffer.suboffsets = NULL
+
+	def __releasebuffer__(self, Py_buffer* buffer):
+		pass
+
+
+cdef class _NodeVectorBuffer(_ContiguousBuffer):
+	""" Owns a vector of nodes moved out of C++. """
+	cdef vector[node] values
+
+	cdef expose(self):
+		self.setStorage(&self.values[0] if self.values.size() > 0 else NULL, self.values.size(), 1, sizeof(node), b'Q', False)
+		return numpy.asarray(self)
+
+
+cdef class _NodePairVectorBuffer(_ContiguousBuffer):
+	""" Owns a vector of node pairs, e.g. edges, moved out of C++. """
+	cdef vector[pair[node, node]] values
+
+	cdef expose(self):
+		self.setStorage(&self.values[0] if self.values.size() > 0 else NULL, self.values.size(), 2, sizeof(node), b'Q', False)
+		return numpy.asarray(self)
+
+
 cdef extern from "cpp/base/Algorithm.h":
 	cdef cppclass _Algorithm "NetworKit::Algorithm":
 		_Algorithm()
@@ -785,6 +855,32 @@ cdef class Graph:
 		"""
 		return self._this.edges()
 
+	def nodesArray(self):
+		""" Get all nodes as a NumPy array. Unlike nodes(), the nodes are not converted one by one,
+		the array uses the memory of the C++ result directly.
+
+	 	Returns
+	 	-------
+	 	numpy.ndarray
+	 		Array of all nodes.
+		"""
+		cdef _NodeVectorBuffer buffer = _NodeVectorBuffer()
+		buffer.values = move(self._this.nodes())
+		return buffer.expose()
+
+	def edgesArray(self):
+		""" Get all edges as a NumPy array with one row per edge. Unlike edges(), the edges are not
+		converted one by one, the array uses the memory of the C++ result directly.
+
+	 	Returns
+	 	-------
+	 	numpy.ndarray
+	 		Array of shape (m, 2) with the end nodes of each edge.
+		"""
+		cdef _NodePairVectorBuffer buffer = _NodePairVectorBuffer()
+		buffer.values = move(self._this.edges())
+		return buffer.expose()
+
 	def neighbors(self, u):
 		""" Get list of neighbors of `u`.
 
@@ -1170,6 +1266,112 @@ cdef class Graph:
 
 # TODO: expose all methods
 
+cdef extern from "cpp/graph/GraphBuilder.h":
+	cdef cppclass _GraphBuilder "NetworKit::GraphBuilder":
+		_GraphBuilder(count n, bool weighted, bool directed) except +
+		void addEdges(count m, const node* sources, const node* targets, const edgeweight* weights, bool removeSelfLoops, bool removeMultiEdges) nogil except +
+		_Graph toGraph(bool autoCompleteEdges, bool parallel) nogil except +
+		count numberOfNodes() except +
+
+cdef class GraphBuilder:
+	""" Builds a graph from whole arrays of edges without adding them one by one.
+
+		GraphBuilder(n=0, weighted=False, directed=False)
+
+		Create a builder for a graph of `n` nodes.
+
+		Parameters
+		----------
+		n : count, optional
+			Number of nodes.
+		weighted : bool, optional
+			If set to True, the graph can have edge weights other than 1.0.
+		directed : bool, optional
+			If set to True, the graph will be directed.
+	"""
+	cdef _GraphBuilder* _this
+
+	def __cinit__(self, count n=0, bool weighted=False, bool directed=False):
+		self._this = new _GraphBuilder(n, weighted, directed)
+
+	def __dealloc__(self):
+		del self._this
+
+	def numberOfNodes(self):
+		"""
+		Get the number of nodes in the graph.
+
+		Returns
+		-------
+		count
+			The number of nodes.
+		"""
+		return self._this.numberOfNodes()
+
+	def addEdges(self, sources, targets, weights=None, bool removeSelfLoops=False, bool removeMultiEdges=False):
+		"""
+		Add the edges given as coordinate lists, i.e. the i-th edge goes from sources[i] to targets[i]
+		and has the weight weights[i]. The arrays are read in place if they are contiguous NumPy
+		arrays of type uint64 (nodes) and float64 (weights), otherwise they are converted first.
+
+		Parameters
+		----------
+		sources : numpy.ndarray
+			Source nodes of the edges.
+		targets : numpy.ndarray
+			Target nodes of the edges.
+		weights : numpy.ndarray, optional
+			Weights of the edges, the default weight is used if not given.
+		removeSelfLoops : bool, optional
+			If set to True, self loops are skipped.
+		removeMultiEdges : bool, optional
+			If set to True, only the first of several edges between the same nodes is added.
+
+		Returns
+		-------
+		GraphBuilder
+			self
+		"""
+		cdef const node[::1] sourceView = numpy.ascontiguousarray(sources, dtype=numpy.uint64)
+		cdef const node[::1] targetView = numpy.ascontiguousarray(targets, dtype=numpy.uint64)
+		cdef const edgeweight[::1] weightView
+		cdef const edgeweight* weightData = NULL
+		cdef count m = sourceView.shape[0]
+		if targetView.shape[0] != m:
+			raise ValueError("sources and targets must have the same length")
+		if weights is not None:
+			weightView = numpy.ascontiguousarray(weights, dtype=numpy.float64)
+			if weightView.shape[0] != m:
+				raise ValueError("weights must have the same length as sources and targets")
+			if m > 0:
+				weightData = &weightView[0]
+		if m > 0:
+			with nogil:
+				self._this.addEdges(m, &sourceView[0], &targetView[0], weightData, removeSelfLoops, removeMultiEdges)
+		return self
+
+	def toGraph(self, bool autoCompleteEdges=True, bool parallel=False):
+		"""
+		Generate the graph, which resets the builder.
+
+		Parameters
+		----------
+		autoCompleteEdges : bool, optional
+			If set to True, the second half of each edge is added, which edges added by addEdges need.
+		parallel : bool, optional
+			If set to True, the edges are completed in parallel.
+
+		Returns
+		-------
+		Graph
+			The graph.
+		"""
+		cdef _Graph result
+		with nogil:
+			result = move(self._this.toGraph(autoCompleteEdges, parallel))
+		return Graph().setThis(result)
+
+
 cdef extern from "cpp/graph/SSSP.h":
 	cdef cppclass _SSSP "NetworKit::SSSP"(_Algorithm):
 		_SSSP(_Graph G, node source, bool storePaths, bool storeStack, node target) except +
@@ -1773,7 +1975,7 @@ cdef class PubWebGenerator:
 
 cdef extern from "cpp/generators/ErdosRenyiGenerator.h":
 	cdef cppclass _ErdosRenyiGenerator "NetworKit::ErdosRenyiGenerator":
-		_ErdosRenyiGenerator(count nNodes, double prob, bool directed) except +
+		_ErdosRenyiGenerator(count nNodes, double prob, bool directed, bool parallel) except +
 		_Graph generate() except +
 
 cdef class ErdosRenyiGenerator:
@@ -1793,12 +1995,14 @@ cdef class ErdosRenyiGenerator:
 		Probability of existence for each edge p.
 	directed : bool
 		Generates a directed
+	parallel : bool
+		Generate the graph in parallel. The result only depends on the random seed, not on the number of threads.
 	"""
 
 	cdef _ErdosRenyiGenerator* _this
 
-	def __cinit__(self, nNodes, prob, directed=False):
-		self._this = new _ErdosRenyiGenerator(nNodes, prob, directed)
+	def __cinit__(self, nNodes, prob, directed=False, parallel=False):
+		self._this = new _ErdosRenyiGenerator(nNodes, prob, directed, parallel)
 
 	def __dealloc__(self):
 		del self._this
@@ -1995,7 +2199,7 @@ cdef class ClusteredRandomGraphGenerator:
 
 cdef extern from "cpp/generators/ChungLuGenerator.h":
 	cdef cppclass _ChungLuGenerator "NetworKit::ChungLuGenerator":
-		_ChungLuGenerator(vector[count] degreeSequence) except +
+		_ChungLuGenerator(vector[count] degreeSequence, bool parallel) except +
 		_Graph generate() except +
 
 cdef class ChungLuGenerator:
@@ -2007,12 +2211,19 @@ cdef class ChungLuGenerator:
 		and Chung, Lu: Connected Components in Random Graphs with Given Expected Degree Sequences.
 		Aiello, Chung, Lu: A Random Graph Model for Massive Graphs describes a different generative model
 		which is basically asymptotically equivalent but produces multi-graphs.
+
+		Parameters
+		----------
+		degreeSequence : vector[count]
+			Expected degree sequence.
+		parallel : bool
+			Generate the graph in parallel. The result only depends on the random seed, not on the number of threads.
 	"""
 
 	cdef _ChungLuGenerator* _this
 
-	def __cinit__(self, vector[count] degreeSequence):
-		self._this = new _ChungLuGenerator(degreeSequence)
+	def __cinit__(self, vector[count] degreeSequence, parallel=False):
+		self._this = new _ChungLuGenerator(degreeSequence, parallel)
 
 	def __dealloc__(self):
 		del self._this
@@ -2233,6 +2444,7 @@ cdef extern from "cpp/generators/RmatGenerator.h":
 	cdef cppclass _RmatGenerator "NetworKit::RmatGenerator":
 		_RmatGenerator(count scale, count edgeFactor, double a, double b, double c, double d, bool weighted, count reduceNodes) except +
 		_Graph generate() except +
+		void writeEdges(string path, bool binary, bool removeDuplicates, count runSize) nogil except +
 
 cdef class RmatGenerator:
 	"""
@@ -2281,6 +2493,27 @@ cdef class RmatGenerator:
 		"""
 		return Graph(0).setThis(self._this.generate())
 
+	def writeEdges(self, path, binary=False, removeDuplicates=False, count runSize=(1 << 26)):
+		""" Generates the edges in parallel and writes them to a file without building a Graph.
+		Weights and reduceNodes are ignored.
+
+		Parameters
+		----------
+		path : str
+			Output file path.
+		binary : bool
+			Write each edge as two 64 bit node ids instead of a line "u v".
+		removeDuplicates : bool
+			Write each (undirected) edge only once, in sorted order. Sorted runs are merged through temporary files.
+		runSize : count
+			Number of edges per sorted run if removeDuplicates is set.
+		"""
+		cdef string cpath = stdstring(path)
+		cdef bool cbinary = binary
+		cdef bool cremove = removeDuplicates
+		with nogil:
+			self._this.writeEdges(cpath, cbinary, cremove, runSize)
+
 	@classmethod
 	def setPaths(cls, kronfitPath, workingDir="/tmp"):
 		cls.paths["kronfitPath"] = kronfitPath
@@ -3196,6 +3429,7 @@ cdef extern from "cpp/structures/Partition.h":
 		count numberOfElements() except +
 		count numberOfSubsets() except +
 		vector[index] getVector() except +
+		const vector[index]& getVectorView() # no exception declaration, otherwise Cython copies the result into a temporary
 		void setName(string name) except +
 		string getName() except +
 		set[index] getSubsetIds() except +
@@ -3216,6 +3450,7 @@ cdef class Partition:
 			Maximum index of an element. Default is 0.
 	"""
 	cdef _Partition _this
+	cdef count _views # NumPy arrays that share the data
 
 	def __cinit__(self, index size=0, vector[index] data=[]):
 		if data.size() != 0:
@@ -3272,6 +3507,8 @@ cdef class Partition:
 		return Partition().setThis(_Partition(self._this))
 
 	cdef setThis(self,  _Partition& other):
+		if self._views > 0:
+			raise BufferError("The partition is shared with NumPy arrays, delete them before replacing it")
 		swap[_Partition](self._this,  other)
 		return self
 
@@ -3300,6 +3537,8 @@ cdef class Partition:
 		index
 			The index of the new element.
 		"""
+		if self._views > 0:
+			raise BufferError("The partition is shared with NumPy arrays, delete them before extending it")
 		return self._this.extend()
 
 	def addToSubset(self, s, e):
@@ -3496,6 +3735,25 @@ cdef class Partition:
 		"""
 		return self._this.getVector()
 
+	def getArray(self):
+		""" Get the vector representing the partition data structure as a read-only NumPy array that
+		shares memory with the partition instead of converting it element by element. The partition
+		cannot be extended or replaced while such an array exists.
+
+		Returns
+		-------
+		numpy.ndarray
+			Array of the subset of each element.
+		"""
+		cdef _PartitionBuffer buffer = _PartitionBuffer()
+		buffer.owner = self
+		self._views += 1
+		if self._this.getVectorView().size() > 0:
+			buffer.setStorage(<const void*>&self._this.getVectorView()[0], self._this.getVectorView().size(), 1, sizeof(index), b'Q', True)
+		else:
+			buffer.setStorage(NULL, 0, 1, sizeof(index), b'Q', True)
+		return numpy.asarray(buffer)
+
 	def setName(self, string name):
 		"""  Set a human-readable identifier `name` for the instance.
 
@@ -3527,6 +3785,15 @@ cdef class Partition:
 		return self._this.getSubsetIds()
 
 
+cdef class _PartitionBuffer(_ContiguousBuffer):
+	""" Shares the data of a partition, which cannot be extended while the buffer exists. """
+	cdef Partition owner
+
+	def __dealloc__(self):
+		if self.owner is not None:
+			self.owner._views -= 1
+
+
 cdef extern from "cpp/structures/Cover.h":
 	cdef cppclass _Cover "NetworKit::Cover":
 		_Cover() except +
@@ -3964,6 +4231,71 @@ cdef class GraphTools:
 		return result
 
 
+cdef extern from "cpp/graph/NodeReordering.h" namespace "NetworKit::NodeReordering":
+	vector[node] reverseCuthillMcKee "NetworKit::NodeReordering::reverseCuthillMcKee"(_Graph G) nogil except +
+	vector[node] degreeDescending "NetworKit::NodeReordering::degreeDescending"(_Graph G) nogil except +
+	vector[node] bfsOrder "NetworKit::NodeReordering::bfsOrder"(_Graph G, node source) nogil except +
+	vector[node] communityOrder "NetworKit::NodeReordering::communityOrder"(_Graph G, _Partition zeta) nogil except +
+	vector[node] gorder "NetworKit::NodeReordering::gorder"(_Graph G, count window) nogil except +
+	_Graph relabel "NetworKit::NodeReordering::relabel"(_Graph G, vector[node] newIds) nogil except +
+	vector[node] invertNodeIds "NetworKit::NodeReordering::invert"(vector[node] newIds) nogil except +
+
+cdef class NodeReordering:
+	""" Node orderings that improve the memory locality of graph traversals. Every ordering is a list
+	mapping each node id to its new id (None for deleted nodes), which relabel() applies to the graph.
+	"""
+
+	@staticmethod
+	def reverseCuthillMcKee(Graph G not None):
+		""" Reverse Cuthill-McKee ordering, which reduces the bandwidth of the adjacency matrix. """
+		return [None if x == none else x for x in reverseCuthillMcKee(G._this)]
+
+	@staticmethod
+	def degreeDescending(Graph G not None):
+		""" Orders the nodes by descending degree. """
+		return [None if x == none else x for x in degreeDescending(G._this)]
+
+	@staticmethod
+	def bfsOrder(Graph G not None, source=None):
+		""" Breadth-first order starting at `source`, the remaining components are traversed in id order. """
+		return [None if x == none else x for x in bfsOrder(G._this, none if source is None else source)]
+
+	@staticmethod
+	def communityOrder(Graph G not None, Partition zeta not None):
+		""" Places the nodes of each subset of `zeta` (e.g. communities found by PLM) consecutively. """
+		return [None if x == none else x for x in communityOrder(G._this, zeta._this)]
+
+	@staticmethod
+	def gorder(Graph G not None, count window=5):
+		""" Greedy ordering following Gorder, which places nodes with many common neighbors within `window` of each other. """
+		return [None if x == none else x for x in gorder(G._this, window)]
+
+	@staticmethod
+	def relabel(Graph G not None, newIds):
+		""" Computes the graph in which node u of `G` has id newIds[u].
+
+		Parameters
+		----------
+		G : Graph
+			The graph.
+		newIds : list
+			A bijection from the nodes of `G` to 0, ..., n-1, e.g. one of the orderings of this class.
+
+		Returns
+		-------
+		Graph
+			The relabelled graph with n nodes and sorted adjacency arrays.
+		"""
+		cdef vector[node] cNewIds = [none if x is None else x for x in newIds]
+		return Graph().setThis(relabel(G._this, cNewIds))
+
+	@staticmethod
+	def invert(newIds):
+		""" Returns the original node id of every new id of `newIds`. """
+		cdef vector[node] cNewIds = [none if x is None else x for x in newIds]
+		return invertNodeIds(cNewIds)
+
+
 cdef extern from "cpp/community/PartitionIntersection.h":
 	cdef cppclass _PartitionIntersection "NetworKit::PartitionIntersection":
 		_PartitionIntersection() except +
@@ -4119,6 +4451,7 @@ cdef extern from "cpp/community/PLP.h":
 	cdef cppclass _PLP "NetworKit::PLP"(_CommunityDetectionAlgorithm):
 		_PLP(_Graph _G, count updateThreshold, count maxIterations) except +
 		_PLP(_Graph _G, _Partition baseClustering, count updateThreshold) except +
+		void setMaxLabelSize(count size) except +
 		count numberOfIterations() except +
 		vector[count] getTiming() except +
 
@@ -4159,6 +4492,17 @@ cdef class PLP(CommunityDetector):
 			self._this = new _PLP(G._this, baseClustering._this, updateThreshold)
 
 
+	def setMaxLabelSize(self, count size):
+		""" Caps the number of nodes per label, a node does not move to a label which is full already.
+
+		Parameters
+		----------
+		size : count
+			The maximum label size.
+		"""
+		(<_PLP*>(self._this)).setMaxLabelSize(size)
+		return self
+
 	def numberOfIterations(self):
 		""" Get number of iterations in last run.
 
@@ -4202,6 +4546,42 @@ cdef class LPDegreeOrdered(CommunityDetector):
 		return (<_LPDegreeOrdered*>(self._this)).numberOfIterations()
 
 
+cdef extern from "cpp/community/MultilevelPartitioner.h":
+	cdef cppclass _MultilevelPartitioner "NetworKit::MultilevelPartitioner"(_CommunityDetectionAlgorithm):
+		_MultilevelPartitioner(_Graph _G, count k, double epsilon) except +
+		count numberOfLevels() except +
+
+
+cdef class MultilevelPartitioner(CommunityDetector):
+	""" Multilevel balanced k-way graph partitioner: the graph is coarsened by size-constrained label propagation,
+	partitioned by greedy graph growing and refined by parallel label propagation on every level while uncoarsening.
+	Every block of the result has at most (1 + epsilon) * ceil(n / k) nodes.
+
+	Parameters
+	----------
+	G : Graph
+		The undirected graph, edge weights are taken into account.
+	k : count
+		The number of blocks.
+	epsilon : double
+		The allowed imbalance.
+	"""
+
+	def __cinit__(self, Graph G not None, count k, double epsilon=0.03):
+		self._G = G
+		self._this = new _MultilevelPartitioner(G._this, k, epsilon)
+
+	def numberOfLevels(self):
+		""" Get the number of levels of the multilevel hierarchy of the last run, including the input graph.
+
+		Returns
+		-------
+		count
+			Number of levels.
+		"""
+		return (<_MultilevelPartitioner*>(self._this)).numberOfLevels()
+
+
 
 cdef extern from "cpp/community/PLM.h":
 	cdef cppclass _PLM "NetworKit::PLM"(_CommunityDetectionAlgorithm):
@@ -5174,6 +5554,7 @@ cdef class Diameter(Algorithm):
 
 cdef extern from "cpp/distance/Eccentricity.h" namespace "NetworKit::Eccentricity":
 	pair[node, count] getValue(_Graph G, node v) except +
+	vector[edgeweight] getValues(_Graph G) nogil except +
 
 cdef class Eccentricity:
 	"""
@@ -5184,6 +5565,86 @@ cdef class Eccentricity:
 	def getValue(Graph G, v):
 		return getValue(G._this, v)
 
+	@staticmethod
+	def getValues(Graph G):
+		"""
+		Computes the eccentricities of all nodes with concurrent searches that refine eccentricity bounds.
+
+		Parameters
+		----------
+		G : Graph
+			The graph, directed graphs have to be strongly connected.
+
+		Returns
+		-------
+		list
+			the eccentricity of every node
+		"""
+		cdef vector[edgeweight] result
+		with nogil:
+			result = getValues(G._this)
+		return result
+
+
+cdef extern from "cpp/distance/EccentricityBounding.h":
+	cdef cppclass _EccentricityBounding "NetworKit::EccentricityBounding"(_Algorithm):
+		_EccentricityBounding(_Graph& G, bool allEccentricities, double error) except +
+		pair[edgeweight, edgeweight] getDiameter() except +
+		vector[edgeweight] getEccentricities() except +
+		vector[edgeweight] getLowerBounds() except +
+		vector[edgeweight] getUpperBounds() except +
+		count numberOfSearches() except +
+
+cdef class EccentricityBounding(Algorithm):
+	"""
+	Computes the diameter or all eccentricities of a graph by refining lower and upper bounds on the
+	eccentricities of all nodes, following the BoundingDiameters algorithm by Takes and Kosters.
+	In every round one BFS or Dijkstra search per thread runs concurrently and tightens the shared bounds.
+	On undirected graphs the diameter is the largest diameter of a connected component, directed graphs
+	have to be strongly connected.
+
+	Parameters
+	----------
+	G : Graph
+		The graph.
+	allEccentricities : bool
+		If true, the eccentricities of all nodes are computed, otherwise only the diameter.
+	error : double
+		The maximum relative error of the upper bound of the diameter, 0 for the exact diameter.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G not None, allEccentricities=False, double error=0.0):
+		self._G = G
+		self._this = new _EccentricityBounding(G._this, allEccentricities, error)
+
+	def getDiameter(self):
+		"""
+		Returns
+		-------
+		tuple
+			lower and upper bound of the diameter
+		"""
+		return (<_EccentricityBounding*>(self._this)).getDiameter()
+
+	def getEccentricities(self):
+		"""
+		Returns
+		-------
+		list
+			the eccentricity of every node, only if all eccentricities have been computed
+		"""
+		return (<_EccentricityBounding*>(self._this)).getEccentricities()
+
+	def getLowerBounds(self):
+		return (<_EccentricityBounding*>(self._this)).getLowerBounds()
+
+	def getUpperBounds(self):
+		return (<_EccentricityBounding*>(self._this)).getUpperBounds()
+
+	def numberOfSearches(self):
+		return (<_EccentricityBounding*>(self._this)).numberOfSearches()
+
 
 cdef extern from "cpp/distance/EffectiveDiameter.h" namespace "NetworKit::EffectiveDiameter":
 	cdef cppclass _EffectiveDiameter "NetworKit::EffectiveDiameter"(_Algorithm):
@@ -5230,7 +5691,8 @@ cdef class EffectiveDiameterApproximation(Algorithm):
 	Calculates the effective diameter of a graph.
 	The effective diameter is defined as the number of edges on average to reach a given ratio of all other nodes.
 
-	Implementation after the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
+	The graph may be disconnected. Computed by HyperANF, a variant with HyperLogLog counters of the ANF algorithm
+	presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
 
 	[1] by Palmer, Gibbons and Faloutsos which can be found here: http://www.cs.cmu.edu/~christos/PUBLICATIONS/kdd02-anf.pdf
 
@@ -5241,9 +5703,9 @@ cdef class EffectiveDiameterApproximation(Algorithm):
 	ratio : double
 		The percentage of nodes that shall be within stepwidth, default = 0.9
 	k : count
-		number of parallel approximations, bigger k -> longer runtime, more precise result; default = 64
+		number of registers per counter, rounded up to a power of two, bigger k -> longer runtime, more precise result; default = 64
 	r : count
-		number of additional bits, important in tiny graphs; default = 7
+		ignored, kept for compatibility
 	"""
 	cdef Graph _G
 
@@ -5273,7 +5735,8 @@ cdef class HopPlotApproximation(Algorithm):
 	The hop-plot is the set of pairs (d, g(g)) for each natural number d
 	and where g(d) is the fraction of connected node pairs whose shortest connecting path has length at most d.
 
-	Implementation after the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
+	The graph may be disconnected. Computed by HyperANF, a variant with HyperLogLog counters of the ANF algorithm
+	presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
 
 	[1] by Palmer, Gibbons and Faloutsos which can be found here: http://www.cs.cmu.edu/~christos/PUBLICATIONS/kdd02-anf.pdf
 
@@ -5285,9 +5748,9 @@ cdef class HopPlotApproximation(Algorithm):
 		maximum distance between considered nodes
 		set to 0 or negative to get the hop-plot for the entire graph so that each node can reach each other node
 	k : count
-		number of parallel approximations, bigger k -> longer runtime, more precise result; default = 64
+		number of registers per counter, rounded up to a power of two, bigger k -> longer runtime, more precise result; default = 64
 	r : count
-		number of additional bits, important in tiny graphs; default = 7
+		ignored, kept for compatibility
 	"""
 	cdef Graph _G
 
@@ -5354,7 +5817,8 @@ cdef class NeighborhoodFunctionApproximation(Algorithm):
 	The neighborhood function N of a graph G for a given distance t is defined
 	as the number of node pairs (u,v) that can be reached within distance t.
 
-	Implementation after the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
+	The graph may be disconnected. Computed by HyperANF, a variant with HyperLogLog counters of the ANF algorithm
+	presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
 
 	[1] by Palmer, Gibbons and Faloutsos which can be found here: http://www.cs.cmu.edu/~christos/PUBLICATIONS/kdd02-anf.pdf
 
@@ -5363,9 +5827,9 @@ cdef class NeighborhoodFunctionApproximation(Algorithm):
 	G : Graph
 		The graph.
 	k : count
-		number of approximations, bigger k -> longer runtime, more precise result; default = 64
+		number of registers per counter, rounded up to a power of two, bigger k -> longer runtime, more precise result; default = 64
 	r : count
-		number of additional bits, important in tiny graphs; default = 7
+		ignored, kept for compatibility
 	"""
 	cdef Graph _G
 
@@ -5382,6 +5846,56 @@ cdef class NeighborhoodFunctionApproximation(Algorithm):
 		"""
 		return (<_NeighborhoodFunctionApproximation*>(self._this)).getNeighborhoodFunction()
 
+cdef extern from "cpp/distance/HyperANF.h":
+	cdef cppclass _HyperANF "NetworKit::HyperANF"(_Algorithm):
+		_HyperANF(_Graph& G, count registerBits, count maxDistance) except +
+		void run() nogil except +
+		vector[double] getNeighborhoodFunction() except +
+		vector[double] getReachableNodes() except +
+
+cdef class HyperANF(Algorithm):
+	"""
+	Approximates the neighborhood function with HyperLogLog counters, following the HyperANF algorithm
+	presented in the paper "HyperANF: Approximating the Neighbourhood Function of Very Large Graphs on a Budget"[1].
+	Every node keeps a counter of 2^registerBits one-byte registers, all counters are stored in one array.
+	Only counters whose out-neighbors changed are recomputed. The graph may be directed and disconnected.
+	The relative standard error of a counter is about 1.04 / sqrt(2^registerBits).
+
+	[1] by Boldi, Rosa and Vigna which can be found here: http://vigna.di.unimi.it/ftp/papers/HyperANF.pdf
+
+	Parameters
+	----------
+	G : Graph
+		The graph.
+	registerBits : count
+		logarithm of the number of registers per counter in [4, 16], bigger -> more memory, more precise result; default = 6
+	maxDistance : count
+		maximum distance that shall be considered, 0 for no limit; default = 0
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G not None, count registerBits=6, count maxDistance=0):
+		self._G = G
+		self._this = new _HyperANF(G._this, registerBits, maxDistance)
+
+	def getNeighborhoodFunction(self):
+		"""
+		Returns
+		-------
+		list
+			the t-th element is the estimated number of node pairs (u,v), including (u,u), such that v is reachable from u within distance t
+		"""
+		return (<_HyperANF*>(self._this)).getNeighborhoodFunction()
+
+	def getReachableNodes(self):
+		"""
+		Returns
+		-------
+		list
+			the estimated number of nodes reachable from every node, including the node itself
+		"""
+		return (<_HyperANF*>(self._this)).getReachableNodes()
+
 cdef extern from "cpp/distance/NeighborhoodFunctionHeuristic.h" namespace "NetworKit::NeighborhoodFunctionHeuristic::SelectionStrategy":
 	enum _SelectionStrategy "NetworKit::NeighborhoodFunctionHeuristic::SelectionStrategy":
 		RANDOM
@@ -5458,6 +5972,7 @@ cdef extern from "cpp/centrality/Centrality.h":
 	cdef cppclass _Centrality "NetworKit::Centrality"(_Algorithm):
 		_Centrality(_Graph, bool, bool) except +
 		vector[double] scores() except +
+		const vector[double]& scoresView() # no exception declaration, otherwise Cython copies the result into a temporary
 		vector[pair[node, double]] ranking() except +
 		double score(node) except +
 		double maximum() except +
@@ -5468,6 +5983,7 @@ cdef class Centrality(Algorithm):
 	""" Abstract base class for centrality measures"""
 
 	cdef Graph _G
+	cdef count _views # NumPy arrays that share the scores
 
 	def __init__(self, *args, **kwargs):
 		if type(self) == Centrality:
@@ -5476,11 +5992,49 @@ cdef class Centrality(Algorithm):
 	def __dealloc__(self):
 		self._G = None # just to be sure the graph is deleted
 
+	def run(self):
+		"""
+		Executes the algorithm.
+
+		Returns
+		-------
+		Algorithm:
+			self
+		"""
+		if self._views > 0:
+			raise BufferError("The scores are shared with NumPy arrays, delete them before running the algorithm again")
+		return Algorithm.run(self)
+
 	def scores(self):
 		if self._this == NULL:
 			raise RuntimeError("Error, object not properly initialized")
 		return (<_Centrality*>(self._this)).scores()
 
+	def scoresArray(self):
+		"""
+		Get the scores as a read-only NumPy array that shares memory with the algorithm instead of
+		converting the scores one by one. The algorithm cannot be run again while such an array exists.
+
+		Returns
+		-------
+		numpy.ndarray
+			Array of the scores, indexed by node.
+		"""
+		cdef _CentralityScoresBuffer buffer
+		cdef _Centrality* centrality = <_Centrality*>(self._this)
+		if self._this == NULL:
+			raise RuntimeError("Error, object not properly initialized")
+		if not self._this.hasFinished():
+			raise RuntimeError("Call run method first")
+		buffer = _CentralityScoresBuffer()
+		buffer.owner = self
+		self._views += 1
+		if centrality.scoresView().size() > 0:
+			buffer.setStorage(<const void*>&centrality.scoresView()[0], centrality.scoresView().size(), 1, sizeof(double), b'd', True)
+		else:
+			buffer.setStorage(NULL, 0, 1, sizeof(double), b'd', True)
+		return numpy.asarray(buffer)
+
 	def score(self, v):
 		if self._this == NULL:
 			raise RuntimeError("Error, object not properly initialized")
@@ -5511,6 +6065,15 @@ cdef class Centrality(Algorithm):
 			raise RuntimeError("Error, object not properly initialized")
 		return (<_Centrality*>(self._this)).centralization()
 
+cdef class _CentralityScoresBuffer(_ContiguousBuffer):
+	""" Shares the scores of a centrality algorithm, which cannot run again while the buffer exists. """
+	cdef Centrality owner
+
+	def __dealloc__(self):
+		if self.owner is not None:
+			self.owner._views -= 1
+
+
 cdef extern from "cpp/centrality/TopCloseness.h":
 	cdef cppclass _TopCloseness "NetworKit::TopCloseness":
 		_TopCloseness(_Graph G, count, bool, bool) except +
@@ -5570,6 +6133,60 @@ cdef class TopCloseness:
 		return self._this.topkScoresList()
 
 
+cdef extern from "cpp/centrality/ParallelTopCloseness.h":
+	cdef cppclass _ParallelTopCloseness "NetworKit::ParallelTopCloseness"(_Algorithm):
+		_ParallelTopCloseness(_Graph G, count k, bool harmonic) except +
+		vector[node] topkNodesList() except +
+		vector[double] topkScoresList() except +
+		count numberOfPrunedSearches() except +
+
+
+cdef class ParallelTopCloseness(Algorithm):
+	"""
+	Finds the k nodes with highest closeness or harmonic centrality without computing the centrality of all nodes.
+	The threads run searches from the nodes in order of decreasing degree and cut a search off as soon as
+	an upper bound on the centrality of its source drops below the current k-th score, following
+	"Computing Top-k Closeness Centrality Faster in Unweighted Graphs", Bergamini et al., ALENEX16.
+	Weighted graphs are searched by Dijkstra. The closeness of a node reaching r nodes at total distance f
+	is (r-1)^2 / ((n-1) f), the harmonic centrality is the sum of inverse distances divided by n-1.
+
+	Parameters
+	----------
+	G : Graph
+		The graph.
+	k : count
+		Number of nodes with highest centrality that have to be found.
+	harmonic : bool
+		If true, harmonic centrality is used, otherwise closeness.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G not None, count k=1, harmonic=False):
+		self._G = G
+		self._this = new _ParallelTopCloseness(G._this, k, harmonic)
+
+	def topkNodesList(self):
+		"""
+		Returns
+		-------
+		list
+			The k nodes with highest centrality, ties broken by smaller id.
+		"""
+		return (<_ParallelTopCloseness*>(self._this)).topkNodesList()
+
+	def topkScoresList(self):
+		"""
+		Returns
+		-------
+		list
+			The k highest centrality scores.
+		"""
+		return (<_ParallelTopCloseness*>(self._this)).topkScoresList()
+
+	def numberOfPrunedSearches(self):
+		return (<_ParallelTopCloseness*>(self._this)).numberOfPrunedSearches()
+
+
 cdef extern from "cpp/centrality/DegreeCentrality.h":
 	cdef cppclass _DegreeCentrality "NetworKit::DegreeCentrality" (_Centrality):
 		_DegreeCentrality(_Graph, bool normalized, bool outdeg, bool ignoreSelfLoops) except +
@@ -5688,11 +6305,11 @@ cdef class KPathCentrality(Centrality):
 
 cdef extern from "cpp/centrality/KatzCentrality.h":
 	cdef cppclass _KatzCentrality "NetworKit::KatzCentrality" (_Centrality):
-		_KatzCentrality(_Graph, double, double, double) except +
+		_KatzCentrality(_Graph, double, double, double, bool) except +
 
 cdef class KatzCentrality(Centrality):
 	"""
-		KatzCentrality(G, alpha=5e-4, beta=0.1, tol=1e-8)
+		KatzCentrality(G, alpha=5e-4, beta=0.1, tol=1e-8, singlePrecision=False)
 
 		Constructs a KatzCentrality object for the given Graph `G`
 
@@ -5706,11 +6323,13 @@ cdef class KatzCentrality(Centrality):
 			Constant value added to the centrality of each vertex
 		tol : double
 			The tolerance for convergence.
+		singlePrecision : bool
+			Iterate in single precision, which is faster but limits the accuracy.
 	"""
 
-	def __cinit__(self, Graph G, alpha=0.2, beta=0.1, tol=1e-8):
+	def __cinit__(self, Graph G, alpha=0.2, beta=0.1, tol=1e-8, singlePrecision=False):
 		self._G = G
-		self._this = new _KatzCentrality(G._this, alpha, beta, tol)
+		self._this = new _KatzCentrality(G._this, alpha, beta, tol, singlePrecision)
 
 
 
@@ -5760,6 +6379,49 @@ cdef class ApproxBetweenness(Centrality):
 
 
 
+cdef extern from "cpp/centrality/KadabraBetweenness.h":
+	cdef cppclass _KadabraBetweenness "NetworKit::KadabraBetweenness" (_Centrality):
+		_KadabraBetweenness(_Graph, double, double, count) except +
+		count numberOfSamples() except +
+		count maximumNumberOfSamples() except +
+
+cdef class KadabraBetweenness(Centrality):
+	""" Approximation of betweenness centrality by adaptive sampling according to the algorithm described in
+	Michele Borassi and Emanuele Natale: KADABRA is an ADaptive Algorithm for Betweenness via Random Approximation
+
+	KadabraBetweenness(G, epsilon=0.01, delta=0.1, k=0)
+
+	The algorithm approximates the betweenness of all vertices so that the scores are
+	within an additive error epsilon with probability at least (1- delta), or, if k is
+	positive, so that additionally the k nodes with highest betweenness are found.
+	Sampling stops as soon as the guarantee holds, which usually takes far fewer samples
+	than ApproxBetweenness. The values are normalized.
+
+	Parameters
+	----------
+	G : Graph
+		the graph, unweighted
+	epsilon : double, optional
+		maximum additive error
+	delta : double, optional
+		probability that the values are not within the error guarantee
+	k : count, optional
+		if positive, sampling stops once the top-k nodes are certain or within the error
+	"""
+
+	def __cinit__(self, Graph G, epsilon=0.01, delta=0.1, k=0):
+		self._G = G
+		self._this = new _KadabraBetweenness(G._this, epsilon, delta, k)
+
+	def numberOfSamples(self):
+		""" Returns the number of samples taken in the last run. """
+		return (<_KadabraBetweenness*>(self._this)).numberOfSamples()
+
+	def maximumNumberOfSamples(self):
+		""" Returns the maximum number of samples, given by the static bound on the vertex diameter. """
+		return (<_KadabraBetweenness*>(self._this)).maximumNumberOfSamples()
+
+
 cdef extern from "cpp/centrality/ApproxBetweenness2.h":
 	cdef cppclass _ApproxBetweenness2 "NetworKit::ApproxBetweenness2" (_Centrality):
 		_ApproxBetweenness2(_Graph, count, bool, bool) except +
@@ -5854,12 +6516,12 @@ cdef class ApproxCloseness(Centrality):
 
 cdef extern from "cpp/centrality/PageRank.h":
 	cdef cppclass _PageRank "NetworKit::PageRank" (_Centrality):
-		_PageRank(_Graph, double damp, double tol) except +
+		_PageRank(_Graph, double damp, double tol, bool singlePrecision, bool gaussSeidel, bool extrapolate) except +
 
 cdef class PageRank(Centrality):
 	"""	Compute PageRank as node centrality measure.
 
-	PageRank(G, damp=0.85, tol=1e-9)
+	PageRank(G, damp=0.85, tol=1e-9, singlePrecision=False, gaussSeidel=False, extrapolate=False)
 
 	Parameters
 	----------
@@ -5869,23 +6531,29 @@ cdef class PageRank(Centrality):
 		Damping factor of the PageRank algorithm.
 	tol : double, optional
 		Error tolerance for PageRank iteration.
+	singlePrecision : bool, optional
+		Iterate in single precision, which is faster but limits the accuracy.
+	gaussSeidel : bool, optional
+		Use Gauss-Seidel updates, which run sequentially but usually need fewer iterations.
+	extrapolate : bool, optional
+		Periodically extrapolate the iterates to speed up convergence.
 	"""
 
-	def __cinit__(self, Graph G, double damp=0.85, double tol=1e-9):
+	def __cinit__(self, Graph G, double damp=0.85, double tol=1e-9, singlePrecision=False, gaussSeidel=False, extrapolate=False):
 		self._G = G
-		self._this = new _PageRank(G._this, damp, tol)
+		self._this = new _PageRank(G._this, damp, tol, singlePrecision, gaussSeidel, extrapolate)
 
 
 
 cdef extern from "cpp/centrality/EigenvectorCentrality.h":
 	cdef cppclass _EigenvectorCentrality "NetworKit::EigenvectorCentrality" (_Centrality):
-		_EigenvectorCentrality(_Graph, double tol) except +
+		_EigenvectorCentrality(_Graph, double tol, bool singlePrecision) except +
 
 cdef class EigenvectorCentrality(Centrality):
 	"""	Computes the leading eigenvector of the graph's adjacency matrix (normalized in 2-norm).
 	Interpreted as eigenvector centrality score.
 
-	EigenvectorCentrality(G, tol=1e-9)
+	EigenvectorCentrality(G, tol=1e-9, singlePrecision=False)
 
 	Constructs the EigenvectorCentrality class for the given Graph `G`. `tol` defines the tolerance for convergence.
 
@@ -5895,11 +6563,13 @@ cdef class EigenvectorCentrality(Centrality):
 		The graph.
 	tol : double, optional
 		The tolerance for convergence.
+	singlePrecision : bool, optional
+		Iterate in single precision, which is faster but limits the accuracy.
 	"""
 
-	def __cinit__(self, Graph G, double tol=1e-9):
+	def __cinit__(self, Graph G, double tol=1e-9, singlePrecision=False):
 		self._G = G
-		self._this = new _EigenvectorCentrality(G._this, tol)
+		self._this = new _EigenvectorCentrality(G._this, tol, singlePrecision)
 
 
 cdef extern from "cpp/centrality/CoreDecomposition.h":
@@ -6294,6 +6964,80 @@ cdef class DGSWriter:
 		self._this.write(_stream, stdstring(path))
 
 
+cdef extern from "cpp/dynamics/BinaryEventStream.h":
+	cdef cppclass _BinaryEventStreamWriter "NetworKit::BinaryEventStreamWriter":
+		_BinaryEventStreamWriter(string path, count blockSize) except +
+		void write(vector[_GraphEvent] stream) except +
+		void close() except +
+
+	cdef cppclass _BinaryEventStreamReader "NetworKit::BinaryEventStreamReader":
+		_BinaryEventStreamReader(string path) except +
+		bool next(vector[_GraphEvent]& batch) except +
+		vector[_GraphEvent] getStream() except +
+		uint64_t getTimeSteps() except +
+
+
+cdef class BinaryEventStreamWriter:
+	""" Writes graph events to a compact binary log (delta-encoded, bit-packed blocks).
+
+	BinaryEventStreamWriter(path, blockSize=65536)
+
+	Parameters
+	----------
+	path : str
+		Output file.
+	blockSize : count
+		Number of events per compressed block.
+	"""
+	cdef _BinaryEventStreamWriter* _this
+
+	def __cinit__(self, path, count blockSize=65536):
+		self._this = new _BinaryEventStreamWriter(stdstring(path), blockSize)
+
+	def __dealloc__(self):
+		del self._this
+
+	def write(self, stream):
+		""" Append a list of GraphEvents to the log. """
+		cdef vector[_GraphEvent] _stream
+		for ev in stream:
+			_stream.push_back(_GraphEvent(ev.type, ev.u, ev.v, ev.w))
+		self._this.write(_stream)
+
+	def close(self):
+		""" Flush pending events and close the file. """
+		self._this.close()
+
+
+cdef class BinaryEventStreamReader:
+	""" Reads a log written by BinaryEventStreamWriter block by block.
+
+	BinaryEventStreamReader(path)
+	"""
+	cdef _BinaryEventStreamReader* _this
+
+	def __cinit__(self, path):
+		self._this = new _BinaryEventStreamReader(stdstring(path))
+
+	def __dealloc__(self):
+		del self._this
+
+	def next(self):
+		""" Return the events of the next block, or None at the end of the stream. """
+		cdef vector[_GraphEvent] batch
+		if not self._this.next(batch):
+			return None
+		return [GraphEvent(ev.type, ev.u, ev.v, ev.w) for ev in batch]
+
+	def getStream(self):
+		""" Return all remaining events. """
+		return [GraphEvent(ev.type, ev.u, ev.v, ev.w) for ev in self._this.getStream()]
+
+	def getTimeSteps(self):
+		""" Number of time steps read so far. """
+		return self._this.getTimeSteps()
+
+
 # cdef extern from "cpp/dcd2/DynamicCommunityDetection.h":
 # 	cdef cppclass _DynamicCommunityDetection "NetworKit::DynamicCommunityDetection":
 # 		_DynamicCommunityDetection(string inputPath, string algoName, string updateStrategy, count interval, count restart, vector[string] recordSettings) except +
@@ -6733,6 +7477,8 @@ cdef extern from "cpp/linkprediction/LinkPredictor.h":
 		double run(node u, node v) except +
 		vector[pair[pair[node, node], double]] runAll() except +
 		vector[pair[pair[node, node], double]] runOn(vector[pair[node, node]] nodePairs) except +
+		vector[pair[pair[node, node], double]] runTopK(count k) nogil except +
+		vector[pair[pair[node, node], double]] runTopKPerNode(count k) nogil except +
 		void setGraph(const _Graph& newGraph) except +
 
 cdef class LinkPredictor:
@@ -6817,6 +7563,43 @@ cdef class LinkPredictor:
 		"""
 		return move(self._this.runOn(nodePairs))
 
+	def runTopK(self, count k):
+		""" Returns the k node-pairs with the highest scores among all unconnected node-pairs at distance 2.
+
+		The candidates are generated on the fly and each thread keeps only its best k predictions,
+		so unlike runAll the memory does not grow with the number of candidate pairs.
+
+		Parameters
+		----------
+		k : count
+			Number of predictions to return.
+
+		Returns
+		-------
+		A vector of the best k predictions (u, v) with u < v, sorted descendingly by score.
+		"""
+		cdef vector[pair[pair[node, node], double]] result
+		with nogil:
+			result = self._this.runTopK(k)
+		return move(result)
+
+	def runTopKPerNode(self, count k):
+		""" Returns for every node u the k best node-pairs (u, v) among the unconnected node-pairs at distance 2.
+
+		Parameters
+		----------
+		k : count
+			Number of predictions per node.
+
+		Returns
+		-------
+		A vector of predictions grouped by ascending u, every group sorted descendingly by score.
+		"""
+		cdef vector[pair[pair[node, node], double]] result
+		with nogil:
+			result = self._this.runTopKPerNode(k)
+		return move(result)
+
 cdef extern from "cpp/linkprediction/KatzIndex.h":
 	cdef cppclass _KatzIndex "NetworKit::KatzIndex"(_LinkPredictor):
 		_KatzIndex(count maxPathLength, double dampingValue) except +
@@ -8871,6 +9654,58 @@ cdef class CommuteTimeDistance:
 		return self._this.runSingleSource(u)
 
 
+cdef extern from "cpp/distance/EffectiveResistanceSketch.h":
+	cdef cppclass _EffectiveResistanceSketch "NetworKit::EffectiveResistanceSketch"(_Algorithm):
+		_EffectiveResistanceSketch(_Graph G, double epsilon) except +
+		double effectiveResistance(node, node) except +
+		vector[double] effectiveResistances(vector[pair[node, node]]) except +
+		vector[double] edgeScores() except +
+		count getSketchDimension() except +
+
+
+cdef class EffectiveResistanceSketch(Algorithm):
+	""" Johnson-Lindenstrauss sketch of the effective resistances of an undirected graph. run() solves
+	O(log(n) / epsilon^2) Laplacian systems in parallel, afterwards every pair query only reads the sketch.
+
+	EffectiveResistanceSketch(G, epsilon=0.1)
+
+	Parameters
+	----------
+	G : Graph
+		The graph.
+	epsilon : double
+		The resistances are approximated within a factor of 1 +/- epsilon with high probability.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G, double epsilon = 0.1):
+		self._G = G
+		self._this = new _EffectiveResistanceSketch(G._this, epsilon)
+
+	def effectiveResistance(self, node u, node v):
+		""" Returns the approximate effective resistance between node u and node v.
+
+		u : node
+		v : node
+		"""
+		return (<_EffectiveResistanceSketch*>(self._this)).effectiveResistance(u, v)
+
+	def effectiveResistances(self, vector[pair[node, node]] pairs):
+		""" Returns the approximate effective resistances of a list of node pairs.
+
+		pairs : list of (node, node)
+		"""
+		return (<_EffectiveResistanceSketch*>(self._this)).effectiveResistances(pairs)
+
+	def edgeScores(self):
+		""" Returns weight times effective resistance (spanning edge centrality) for every edge, indexed by edge id. """
+		return (<_EffectiveResistanceSketch*>(self._this)).edgeScores()
+
+	def getSketchDimension(self):
+		""" Returns the number of random projections. """
+		return (<_EffectiveResistanceSketch*>(self._this)).getSketchDimension()
+
+
 # stats
 
 def gini(values):
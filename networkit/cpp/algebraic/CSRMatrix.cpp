@@ -9,6 +9,7 @@
 
 #include <cassert>
 #include <atomic>
+#include <algorithm>
 #include "omp.h"
 
 namespace NetworKit {
@@ -61,12 +62,10 @@ CSRMatrix::CSRMatrix(const count nRows, const count nCols, const std::vector<Tri
 
 CSRMatrix::CSRMatrix(const count nRows, const count nCols, const std::vector<std::vector<index>> &columnIdx, const std::vector<std::vector<double>> &values,  const double zero, bool isSorted) : nRows(nRows), nCols(nCols), isSorted(isSorted), zero(zero) {
 	 rowIdx = std::vector<index>(nRows + 1, 0);
-	 count nnz = columnIdx[0].size();
-	 for (index i = 1; i < columnIdx.size(); ++i) {
-		 rowIdx[i] = rowIdx[i-1] + columnIdx[i-1].size();
-		 nnz += columnIdx[i].size();
+	 for (index i = 0; i < nRows; ++i) {
+		 rowIdx[i+1] = rowIdx[i] + columnIdx[i].size();
 	 }
-	 rowIdx[nRows] = nnz;
+	 count nnz = rowIdx[nRows];
 
 	 this->columnIdx = std::vector<index>(nnz);
 	 this->nonZeros = std::vector<double>(nnz);
@@ -207,6 +206,18 @@ index CSRMatrix::binarySearchColumns(index left, index right, index j) const {
 	}
 }
 
+void CSRMatrix::rowRange(index part, count numParts, index& begin, index& end) const {
+	// split at rows such that every part holds about the same number of non-zeros
+	auto splitRow = [&](index p) -> index {
+		if (p == 0) return 0;
+		if (p >= numParts) return nRows;
+		index target = (nnz() * p) / numParts;
+		return std::lower_bound(rowIdx.begin(), rowIdx.begin() + nRows, target) - rowIdx.begin();
+	};
+	begin = splitRow(part);
+	end = std::max(begin, splitRow(part+1));
+}
+
 void CSRMatrix::sort() {
 #pragma omp parallel for schedule(guided)
 	for (index i = 0; i < nRows; ++i) {
@@ -331,11 +342,20 @@ CSRMatrix& CSRMatrix::operator*=(const double &scalar) {
 }
 
 Vector CSRMatrix::operator*(const Vector &vector) const {
+	Vector result;
+	multiply(vector, result);
+	return result;
+}
+
+void CSRMatrix::multiply(const Vector &vector, Vector &result) const {
 	assert(!vector.isTransposed());
 	assert(nCols == vector.getDimension());
+	assert(&vector != &result);
 
-	Vector result(nRows, zero);
-#pragma omp parallel for
+	if (result.getDimension() != nRows || result.isTransposed()) {
+		result = Vector(nRows, zero);
+	}
+#pragma omp parallel for schedule(guided)
 	for (index i = 0; i < numberOfRows(); ++i) {
 		double sum = zero;
 		for (index cIdx = rowIdx[i]; cIdx < rowIdx[i+1]; ++cIdx) {
@@ -343,8 +363,6 @@ Vector CSRMatrix::operator*(const Vector &vector) const {
 		}
 		result[i] = sum;
 	}
-
-	return result;
 }
 
 CSRMatrix CSRMatrix::operator*(const CSRMatrix &other) const {
@@ -356,30 +374,27 @@ CSRMatrix CSRMatrix::operator*(const CSRMatrix &other) const {
 
 #pragma omp parallel
 	{
-		std::vector<int64_t> marker(other.numberOfColumns(), -1);
-		count numThreads = omp_get_num_threads();
-		index threadId = omp_get_thread_num();
-
-		count chunkSize = (numberOfRows() + numThreads - 1) / numThreads;
-		index chunkStart = threadId * chunkSize;
-		index chunkEnd = std::min(numberOfRows(), chunkStart + chunkSize);
-
-		for (index i = chunkStart; i < chunkEnd; ++i) {
+		// per-thread sparse accumulator, marker[j] is the last row in which column j was seen
+		std::vector<index> marker(other.numberOfColumns(), none);
+		std::vector<double> acc(other.numberOfColumns());
+
+		// symbolic pass: number of non-zeros per row of the result
+#pragma omp for schedule(guided)
+		for (index i = 0; i < numberOfRows(); ++i) {
+			count nnzInRow = 0;
 			for (index jA = this->rowIdx[i]; jA < this->rowIdx[i+1]; ++jA) {
 				index k = this->columnIdx[jA];
 				for (index jB = other.rowIdx[k]; jB < other.rowIdx[k+1]; ++jB) {
 					index j = other.columnIdx[jB];
-					if (marker[j] != (int64_t) i) {
+					if (marker[j] != i) {
 						marker[j] = i;
-						++rowIdx[i+1];
+						++nnzInRow;
 					}
 				}
 			}
+			rowIdx[i+1] = nnzInRow;
 		}
 
-		std::fill(marker.begin(), marker.end(), -1);
-
-#pragma omp barrier
 #pragma omp single
 		{
 			for (index i = 0; i < numberOfRows(); ++i) {
@@ -390,9 +405,14 @@ CSRMatrix CSRMatrix::operator*(const CSRMatrix &other) const {
 			nonZeros = std::vector<double>(rowIdx[numberOfRows()]);
 		}
 
-		for (index i = chunkStart; i < chunkEnd; ++i) {
-			index rowBegin = rowIdx[i];
-			index rowEnd = rowBegin;
+		// a thread may get the same row in both passes
+		std::fill(marker.begin(), marker.end(), none);
+
+		// numeric pass: accumulate the row in acc, keyed by row index so that the order in which rows are
+		// handed to the threads does not matter
+#pragma omp for schedule(guided)
+		for (index i = 0; i < numberOfRows(); ++i) {
+			index rowEnd = rowIdx[i];
 
 			for (index jA = this->rowIdx[i]; jA < this->rowIdx[i+1]; ++jA) {
 				index k = this->columnIdx[jA];
@@ -402,16 +422,19 @@ CSRMatrix CSRMatrix::operator*(const CSRMatrix &other) const {
 					index j = other.columnIdx[jB];
 					double valB = other.nonZeros[jB];
 
-					if (marker[j] < (int64_t) rowBegin) {
-						marker[j] = rowEnd;
-						columnIdx[rowEnd] = j;
-						nonZeros[rowEnd] = valA * valB;
-						++rowEnd;
+					if (marker[j] != i) {
+						marker[j] = i;
+						acc[j] = valA * valB;
+						columnIdx[rowEnd++] = j;
 					} else {
-						nonZeros[marker[j]] += valA * valB;
+						acc[j] += valA * valB;
 					}
 				}
 			}
+
+			for (index idx = rowIdx[i]; idx < rowEnd; ++idx) {
+				nonZeros[idx] = acc[columnIdx[idx]];
+			}
 		}
 	}
 
@@ -430,108 +453,109 @@ CSRMatrix& CSRMatrix::operator/=(const double &divisor) {
 
 CSRMatrix CSRMatrix::mTmMultiply(const CSRMatrix &A, const CSRMatrix &B) {
 	assert(A.nRows == B.nRows);
-
-	std::vector<std::vector<index>> columnIdx(A.numberOfColumns());
-	std::vector<std::vector<double>> values(A.numberOfColumns());
-
-	for (index k = 0; k < A.numberOfRows(); ++k) {
-		A.forNonZeroElementsInRow(k, [&](index i, double vA) {
-			B.forNonZeroElementsInRow(k, [&](index j, double vB) {
-				bool found = false;
-				for (index l = 0; l < columnIdx[i].size(); ++l) {
-					if (columnIdx[i][l] == j) {
-						values[i][l] += vA * vB;
-						found = true;
-						break;
-					}
-				}
-
-				if (!found) {
-					columnIdx[i].push_back(j);
-					values[i].push_back(vA * vB);
-				}
-			});
-		});
-	}
-
-	return CSRMatrix(A.nCols, B.nCols, columnIdx, values);
+	return A.transpose() * B;
 }
 
 CSRMatrix CSRMatrix::mmTMultiply(const CSRMatrix &A, const CSRMatrix &B) {
 	assert(A.nCols == B.nCols);
-
-	std::vector<std::vector<index>> columnIdx(A.numberOfRows());
-	std::vector<std::vector<double>> values(A.numberOfRows());
-
-	for (index i = 0; i < A.numberOfRows(); ++i) {
-		A.forNonZeroElementsInRow(i, [&](index k, double vA) {
-			for (index j = 0; j < B.numberOfRows(); ++j) {
-				double vB = B(j,k);
-				if (vB != A.zero) {
-					bool found = false;
-					for (index l = 0; l < columnIdx[i].size(); ++l) {
-						if (columnIdx[i][l] == j) {
-							values[i][l] += vA * vB;
-							found = true;
-							break;
-						}
-					}
-
-					if (!found) {
-						columnIdx[i].push_back(j);
-						values[i].push_back(vA * vB);
-					}
-				}
-			}
-		});
-	}
-
-	return CSRMatrix(A.nRows, B.nRows, columnIdx, values);
+	return A * B.transpose();
 }
 
 Vector CSRMatrix::mTvMultiply(const CSRMatrix &matrix, const Vector &vector) {
 	assert(matrix.nRows == vector.getDimension() && !vector.isTransposed());
 
-	Vector result(matrix.numberOfColumns(), 0.0);
-	for (index k = 0; k < matrix.numberOfRows(); ++k) {
-		matrix.forNonZeroElementsInRow(k, [&](index j, double value) {
-			result[j] += value * vector[k];
-		});
+	count nCols = matrix.numberOfColumns();
+	Vector result(nCols, 0.0);
+	std::vector<std::vector<double>> partialResults;
+
+#pragma omp parallel
+	{
+		count numThreads = omp_get_num_threads();
+		index t = omp_get_thread_num();
+#pragma omp single
+		partialResults.resize(numThreads);
+
+		std::vector<double>& partial = partialResults[t];
+		partial.assign(nCols, 0.0);
+		index begin, end;
+		matrix.rowRange(t, numThreads, begin, end);
+		for (index k = begin; k < end; ++k) {
+			double vk = vector[k];
+			for (index idx = matrix.rowIdx[k]; idx < matrix.rowIdx[k+1]; ++idx) {
+				partial[matrix.columnIdx[idx]] += matrix.nonZeros[idx] * vk;
+			}
+		}
+
+#pragma omp barrier
+#pragma omp for
+		for (index j = 0; j < nCols; ++j) {
+			double sum = 0.0;
+			for (const std::vector<double>& p : partialResults) {
+				sum += p[j];
+			}
+			result[j] = sum;
+		}
 	}
 
 	return result;
 }
 
 CSRMatrix CSRMatrix::transpose() const {
-	std::vector<index> rowIdx(numberOfColumns()+1);
-	for (index i = 0; i < nnz(); ++i) {
-		++rowIdx[columnIdx[i]+1];
-	}
+	std::vector<index> rowIdx(numberOfColumns()+1, 0);
+	std::vector<index> columnIdx(nnz());
+	std::vector<double> nonZeros(nnz());
 
-	for (index i = 0; i < numberOfColumns(); ++i) {
-		rowIdx[i+1] += rowIdx[i];
-	}
+	// counting sort by column; every thread counts and scatters a contiguous block of rows
+	std::vector<std::vector<index>> offsets;
+#pragma omp parallel
+	{
+		count numThreads = omp_get_num_threads();
+		index t = omp_get_thread_num();
+#pragma omp single
+		offsets.resize(numThreads);
+
+		std::vector<index>& offset = offsets[t];
+		offset.assign(numberOfColumns(), 0);
+		index begin, end;
+		rowRange(t, numThreads, begin, end);
+		for (index k = this->rowIdx[begin]; k < this->rowIdx[end]; ++k) {
+			++offset[this->columnIdx[k]];
+		}
 
-	std::vector<index> columnIdx(rowIdx[numberOfColumns()]);
-	std::vector<double> nonZeros(rowIdx[numberOfColumns()]);
+#pragma omp barrier
+#pragma omp for
+		for (index j = 0; j < numberOfColumns(); ++j) {
+			for (index s = 0; s < numThreads; ++s) {
+				rowIdx[j+1] += offsets[s][j];
+			}
+		}
 
-	for (index i = 0; i < numberOfRows(); ++i) {
-		for (index j = this->rowIdx[i]; j < this->rowIdx[i+1]; ++j) {
-			index colIdx = this->columnIdx[j];
-			columnIdx[rowIdx[colIdx]] = i;
-			nonZeros[rowIdx[colIdx]] = this->nonZeros[j];
-			++rowIdx[colIdx];
+#pragma omp single
+		for (index j = 0; j < numberOfColumns(); ++j) {
+			rowIdx[j+1] += rowIdx[j];
+		}
+
+#pragma omp for
+		for (index j = 0; j < numberOfColumns(); ++j) {
+			index pos = rowIdx[j];
+			for (index s = 0; s < numThreads; ++s) {
+				index cnt = offsets[s][j];
+				offsets[s][j] = pos;
+				pos += cnt;
+			}
+		}
+
+		for (index i = begin; i < end; ++i) {
+			for (index k = this->rowIdx[i]; k < this->rowIdx[i+1]; ++k) {
+				index dest = offset[this->columnIdx[k]]++;
+				columnIdx[dest] = i;
+				nonZeros[dest] = this->nonZeros[k];
+			}
 		}
 	}
-	index shift = 0;
-	for (index i = 0; i < numberOfColumns(); ++i) {
-		index temp = rowIdx[i];
-		rowIdx[i] = shift;
-		shift = temp;
-	}
-	rowIdx[numberOfColumns()] = nonZeros.size();
 
-	return CSRMatrix(nCols, nRows, rowIdx, columnIdx, nonZeros, getZero());
+	// rows are scattered in increasing order, hence the columns of the transpose are sorted
+	return CSRMatrix(nCols, nRows, rowIdx, columnIdx, nonZeros, getZero(), true);
 }
 
 CSRMatrix CSRMatrix::extract(const std::vector<index>& rowIndices, const std::vector<index>& columnIndices) const {
@@ -61,6 +61,12 @@ private:
 	 */
 	index binarySearchColumns(index left, index right, index j) const;
 
+	/**
+	 * Computes the range [@a begin, @a end) of rows of part @a part when the rows are split into @a numParts
+	 * contiguous parts with about the same number of non-zeros.
+	 */
+	void rowRange(index part, count numParts, index& begin, index& end) const;
+
 public:
 	/** Default constructor */
 	CSRMatrix();
@@ -276,6 +282,13 @@ public:
 	 */
 	Vector operator*(const Vector &vector) const;
 
+	/**
+	 * Multiplies this matrix with @a vector and stores the result in @a result. The memory of @a result is reused if
+	 * it already has the right dimension, so repeated products (e.g. in iterative solvers) do not allocate.
+	 * @a result must not be @a vector.
+	 */
+	void multiply(const Vector &vector, Vector &result) const;
+
 	/**
 	 * Multiplies this matrix with @a other and returns the result in a new matrix.
 	 * @return The result of multiplying this matrix with @a other.
@@ -501,58 +514,62 @@ template<typename L> inline CSRMatrix NetworKit::CSRMatrix::binaryOperator(const
 
 		return CSRMatrix(A.nRows, A.nCols, rowIdx, columnIdx, nonZeros, A.zero, true);
 	} else { // A or B not sorted
-		std::vector<int64_t> columnPointer(A.nCols, -1);
-		std::vector<double> Arow(A.nCols, A.zero);
-		std::vector<double> Brow(A.nCols, B.zero);
-
-		std::vector<Triplet> triplets;
-
-		for (index i = 0; i < A.nRows; ++i) {
-			index listHead = 0;
-			count nnz = 0;
+		std::vector<std::vector<index>> columns(A.nRows);
+		std::vector<std::vector<double>> values(A.nRows);
 
-			// search for nonZeros in our own matrix
-			for (index k = A.rowIdx[i]; k < A.rowIdx[i+1]; ++k) {
-				index j = A.columnIdx[k];
-				Arow[j] = A.nonZeros[k];
+#pragma omp parallel
+		{
+			std::vector<int64_t> columnPointer(A.nCols, -1);
+			std::vector<double> Arow(A.nCols, A.zero);
+			std::vector<double> Brow(A.nCols, B.zero);
 
-				columnPointer[j] = listHead;
-				listHead = j;
-				nnz++;
-			}
+#pragma omp for schedule(guided)
+			for (index i = 0; i < A.nRows; ++i) {
+				index listHead = 0;
+				count nnz = 0;
 
-			// search for nonZeros in the other matrix
-			for (index k = B.rowIdx[i]; k < B.rowIdx[i+1]; ++k) {
-				index j = B.columnIdx[k];
-				Brow[j] = B.nonZeros[k];
+				// search for nonZeros in our own matrix
+				for (index k = A.rowIdx[i]; k < A.rowIdx[i+1]; ++k) {
+					index j = A.columnIdx[k];
+					Arow[j] = A.nonZeros[k];
 
-				if (columnPointer[j] == -1) { // our own matrix does not have a nonZero entry in column j
 					columnPointer[j] = listHead;
 					listHead = j;
 					nnz++;
 				}
-			}
 
-			// apply operator on the found nonZeros in A and B
-			for (count k = 0; k < nnz; ++k) {
-				double value = binaryOp(Arow[listHead], Brow[listHead]);
-				if (value != A.zero) {
-					triplets.push_back({i,listHead,value});
-				}
+				// search for nonZeros in the other matrix
+				for (index k = B.rowIdx[i]; k < B.rowIdx[i+1]; ++k) {
+					index j = B.columnIdx[k];
+					Brow[j] = B.nonZeros[k];
 
-				index temp = listHead;
-				listHead = columnPointer[listHead];
+					if (columnPointer[j] == -1) { // our own matrix does not have a nonZero entry in column j
+						columnPointer[j] = listHead;
+						listHead = j;
+						nnz++;
+					}
+				}
 
-				// reset for next row
-				columnPointer[temp] = -1;
-				Arow[temp] = A.zero;
-				Brow[temp] = B.zero;
+				// apply operator on the found nonZeros in A and B
+				for (count k = 0; k < nnz; ++k) {
+					double value = binaryOp(Arow[listHead], Brow[listHead]);
+					if (value != A.zero) {
+						columns[i].push_back(listHead);
+						values[i].push_back(value);
+					}
+
+					index temp = listHead;
+					listHead = columnPointer[listHead];
+
+					// reset for next row
+					columnPointer[temp] = -1;
+					Arow[temp] = A.zero;
+					Brow[temp] = B.zero;
+				}
 			}
-
-			nnz = 0;
 		}
 
-		return CSRMatrix(A.numberOfRows(), A.numberOfColumns(), triplets);
+		return CSRMatrix(A.numberOfRows(), A.numberOfColumns(), columns, values, A.zero);
 	}
 }
 
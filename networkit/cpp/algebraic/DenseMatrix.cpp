@@ -123,19 +123,28 @@ DenseMatrix& DenseMatrix::operator*=(const double &scalar) {
 }
 
 Vector DenseMatrix::operator*(const Vector &vector) const {
+	Vector result;
+	multiply(vector, result);
+	return result;
+}
+
+void DenseMatrix::multiply(const Vector &vector, Vector &result) const {
 	assert(!vector.isTransposed());
 	assert(numberOfColumns() == vector.getDimension());
+	assert(&vector != &result);
 
-	Vector result(numberOfRows(), zero);
+	if (result.getDimension() != numberOfRows() || result.isTransposed()) {
+		result = Vector(numberOfRows(), zero);
+	}
 #pragma omp parallel for
 	for (index i = 0; i < numberOfRows(); ++i) {
 		index offset = i * numberOfColumns();
+		double sum = zero;
 		for (index k = offset, j = 0; k < offset + numberOfColumns(); ++k, ++j) {
-			result[i] += entries[k] * vector[j];
+			sum += entries[k] * vector[j];
 		}
+		result[i] = sum;
 	}
-
-	return result;
 }
 
 DenseMatrix DenseMatrix::operator*(const DenseMatrix &other) const {
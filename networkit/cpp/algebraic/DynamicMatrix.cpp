@@ -136,15 +136,25 @@ DynamicMatrix& DynamicMatrix::operator*=(const double scalar) {
 }
 
 Vector DynamicMatrix::operator*(const Vector &vector) const {
+	Vector result;
+	multiply(vector, result);
+	return result;
+}
+
+void DynamicMatrix::multiply(const Vector &vector, Vector &result) const {
 	assert(!vector.isTransposed());
 	assert(nCols == vector.getDimension());
-	Vector result(numberOfRows(), zero);
+	assert(&vector != &result);
+
+	if (result.getDimension() != numberOfRows() || result.isTransposed()) {
+		result = Vector(numberOfRows(), zero);
+	} else {
+		result.fill(zero);
+	}
 
 	parallelForNonZeroElementsInRowOrder([&](node i, node j, double value) {
 		result[i] += value * vector[j];
 	});
-
-	return result;
 }
 
 DynamicMatrix DynamicMatrix::operator*(const DynamicMatrix &other) const {
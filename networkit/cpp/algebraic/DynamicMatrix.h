@@ -209,6 +209,13 @@ public:
 	 */
 	Vector operator*(const Vector &vector) const;
 
+	/**
+	 * Multiplies this matrix with @a vector and stores the result in @a result. The memory of @a result is reused if
+	 * it already has the right dimension, so repeated products (e.g. in iterative solvers) do not allocate.
+	 * @a result must not be @a vector.
+	 */
+	void multiply(const Vector &vector, Vector &result) const;
+
 	/**
 	 * Multiplies this matrix with @a other and returns the result in a new matrix.
 	 * @return The result of multiplying this matrix with @a other.
@@ -9,10 +9,13 @@
 #define NETWORKIT_CPP_ALGEBRAIC_GRAPHBLAS_H_
 
 #include <limits>
+#include <algorithm>
+#include <omp.h>
 #include "Semirings.h"
 #include "SparseAccumulator.h"
 #include "AlgebraicGlobals.h"
 #include "Vector.h"
+#include "CSRMatrix.h"
 
 /**
  * @ingroup algebraic
@@ -20,6 +23,24 @@
  */
 namespace GraphBLAS {
 
+namespace detail {
+
+/**
+ * Returns SemiRing::add over all SemiRing::mult(A(i,j), v[j]) of row @a i. Stops touching @a v as soon as the
+ * accumulated value is the annihilator of add (see SemiringTraits).
+ */
+template<class SemiRing, class Matrix>
+inline double rowTimesVector(const Matrix& A, NetworKit::index i, const NetworKit::Vector& v) {
+	double acc = SemiRing::zero();
+	A.forNonZeroElementsInRow(i, [&](NetworKit::index j, double value) {
+		if (SemiringTraits<SemiRing>::hasAddAnnihilator && acc == SemiringTraits<SemiRing>::addAnnihilator()) return;
+		acc = SemiRing::add(acc, SemiRing::mult(value, v[j]));
+	});
+	return acc;
+}
+
+} /* namespace detail */
+
 // ****************************************************
 // 						Operations
 // ****************************************************
@@ -102,25 +123,108 @@ Matrix MxM(const Matrix& A, const Matrix& B) {
 	assert(A.numberOfColumns() == B.numberOfRows());
 	assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero());
 
-	std::vector<NetworKit::Triplet> triplets;
-	NetworKit::SparseAccumulator spa(B.numberOfRows());
-	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
-		A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
-			B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
-				spa.scatter(SemiRing::mult(w1,w2), j, *SemiRing::add);
+	std::vector<std::vector<NetworKit::Triplet>> threadTriplets(omp_get_max_threads());
+#pragma omp parallel
+	{
+		std::vector<NetworKit::Triplet>& triplets = threadTriplets[omp_get_thread_num()];
+		NetworKit::SparseAccumulator spa(B.numberOfColumns());
+#pragma omp for schedule(guided)
+		for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
+			A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
+				B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
+					spa.scatter(SemiRing::mult(w1,w2), j, *SemiRing::add);
+				});
 			});
-		});
 
-		spa.gather([&](NetworKit::index i, NetworKit::index j, double value){
-			triplets.push_back({i,j,value});
-		});
+			spa.gather([&](NetworKit::index, NetworKit::index j, double value){
+				triplets.push_back({i,j,value});
+			});
+
+			spa.increaseRow();
+		}
+	}
 
-		spa.increaseRow();
+	std::vector<NetworKit::Triplet> triplets;
+	for (std::vector<NetworKit::Triplet>& part : threadTriplets) {
+		triplets.insert(triplets.end(), part.begin(), part.end());
 	}
 
 	return Matrix(A.numberOfRows(), B.numberOfColumns(), triplets, A.getZero());
 }
 
+/**
+ * Computes the matrix-matrix multiplication of @a A and @a B in CSR format. The result is written directly into
+ * preallocated CSR arrays: a symbolic pass counts the non-zeros of every row, a numeric pass fills them using a
+ * per-thread dense accumulator. The rows of the result are sorted.
+ * @param A
+ * @param B
+ * @return The result of the multiplication A * B.
+ */
+template<class SemiRing = ArithmeticSemiring>
+NetworKit::CSRMatrix MxM(const NetworKit::CSRMatrix& A, const NetworKit::CSRMatrix& B) {
+	assert(A.numberOfColumns() == B.numberOfRows());
+	assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero());
+	NetworKit::count nRows = A.numberOfRows();
+
+	std::vector<NetworKit::index> rowIdx(nRows+1, 0);
+	std::vector<NetworKit::index> columnIdx;
+	std::vector<double> nonZeros;
+
+#pragma omp parallel
+	{
+		std::vector<NetworKit::index> marker(B.numberOfColumns(), NetworKit::none);
+		std::vector<double> acc(B.numberOfColumns());
+
+#pragma omp for schedule(guided)
+		for (NetworKit::index i = 0; i < nRows; ++i) {
+			NetworKit::count nnzInRow = 0;
+			A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double) {
+				B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double) {
+					if (marker[j] != i) {
+						marker[j] = i;
+						++nnzInRow;
+					}
+				});
+			});
+			rowIdx[i+1] = nnzInRow;
+		}
+
+#pragma omp single
+		{
+			for (NetworKit::index i = 0; i < nRows; ++i) {
+				rowIdx[i+1] += rowIdx[i];
+			}
+			columnIdx.resize(rowIdx[nRows]);
+			nonZeros.resize(rowIdx[nRows]);
+		}
+
+		std::fill(marker.begin(), marker.end(), NetworKit::none);
+
+#pragma omp for schedule(guided)
+		for (NetworKit::index i = 0; i < nRows; ++i) {
+			NetworKit::index rowEnd = rowIdx[i];
+			A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
+				B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
+					if (marker[j] != i) {
+						marker[j] = i;
+						acc[j] = SemiRing::mult(w1, w2);
+						columnIdx[rowEnd++] = j;
+					} else {
+						acc[j] = SemiRing::add(acc[j], SemiRing::mult(w1, w2));
+					}
+				});
+			});
+
+			std::sort(columnIdx.begin() + rowIdx[i], columnIdx.begin() + rowEnd);
+			for (NetworKit::index idx = rowIdx[i]; idx < rowEnd; ++idx) {
+				nonZeros[idx] = acc[columnIdx[idx]];
+			}
+		}
+	}
+
+	return NetworKit::CSRMatrix(nRows, B.numberOfColumns(), rowIdx, columnIdx, nonZeros, A.getZero(), true);
+}
+
 /**
  * Computes the matrix-matrix multiplication of @a A and @a B and adds it to @a C where
  * the add operation is that of the specified Semiring (i.e. C(i,j) = SemiRing::add(C(i,j), (A*B)(i,j))).
@@ -134,23 +238,7 @@ void MxM(const Matrix& A, const Matrix& B, Matrix& C) {
 	assert(A.numberOfColumns() == B.numberOfRows() && A.numberOfRows() == C.numberOfRows() && B.numberOfColumns() == C.numberOfColumns());
 	assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero() && C.getZero() == SemiRing::zero());
 
-	std::vector<NetworKit::Triplet> triplets;
-	NetworKit::SparseAccumulator spa(B.numberOfRows());
-	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
-		A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
-			B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
-				spa.scatter(SemiRing::mult(w1,w2), j, *SemiRing::add);
-			});
-		});
-
-		spa.gather([&](NetworKit::index i, NetworKit::index j, double value){
-			triplets.push_back({i,j,value});
-		});
-
-		spa.increaseRow();
-	}
-
-	Matrix temp(A.numberOfRows(), B.numberOfRows(), triplets, A.getZero());
+	Matrix temp = MxM<SemiRing>(A, B);
 	C = eWiseBinOp<SemiRing, Matrix>(C, temp, *SemiRing::add);
 }
 
@@ -168,23 +256,7 @@ void MxM(const Matrix& A, const Matrix& B, Matrix& C, F accum) {
 	assert(A.numberOfColumns() == B.numberOfRows() && A.numberOfRows() == C.numberOfRows() && B.numberOfColumns() == C.numberOfColumns());
 	assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero() && C.getZero() == SemiRing::zero());
 
-	std::vector<NetworKit::Triplet> triplets;
-	NetworKit::SparseAccumulator spa(B.numberOfRows());
-	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
-		A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
-			B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
-				spa.scatter(SemiRing::mult(w1,w2), j, *SemiRing::add);
-			});
-		});
-
-		spa.gather([&](NetworKit::index i, NetworKit::index j, double value){
-			triplets.push_back({i,j,value});
-		});
-
-		spa.increaseRow();
-	}
-
-	Matrix temp(A.numberOfRows(), B.numberOfRows(), triplets, A.getZero());
+	Matrix temp = MxM<SemiRing>(A, B);
 	C = eWiseBinOp<SemiRing, Matrix>(C, temp, accum);
 }
 
@@ -200,9 +272,10 @@ NetworKit::Vector MxV(const Matrix& A, const NetworKit::Vector& v) {
 	assert(A.getZero() == SemiRing::zero());
 	NetworKit::Vector result(A.numberOfRows(), A.getZero());
 
-	A.parallelForNonZeroElementsInRowOrder([&](NetworKit::index i, NetworKit::index j, double value) {
-		result[i] = SemiRing::add(result[i], SemiRing::mult(value, v[j]));
-	});
+#pragma omp parallel for schedule(guided)
+	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
+		result[i] = detail::rowTimesVector<SemiRing>(A, i, v);
+	}
 
 	return result;
 }
@@ -210,7 +283,7 @@ NetworKit::Vector MxV(const Matrix& A, const NetworKit::Vector& v) {
 /**
  * Computes the matrix-vector product of matrix @a A and Vector @a v and adds it to @a c where the add operation
  * is that of the specified Semiring (i.e. c[i] = SemiRing::add(c[i], (A*v)[i]). The default Semiring is the
- * ArithmeticSemiring.
+ * ArithmeticSemiring. @a v and @a c may be the same vector.
  * @param A
  * @param v
  * @param c
@@ -221,15 +294,22 @@ void MxV(const Matrix& A, const NetworKit::Vector& v, NetworKit::Vector& c) {
 	assert(A.numberOfColumns() == v.getDimension());
 	assert(A.getZero() == SemiRing::zero());
 
-	A.parallelForNonZeroElementsInRowOrder([&](NetworKit::index i, NetworKit::index j, double value) {
-		c[i] = SemiRing::add(c[i], SemiRing::mult(value, v[j]));
-	});
+	if (&v == &c) {
+		NetworKit::Vector input = v;
+		MxV<SemiRing>(A, input, c);
+		return;
+	}
+
+#pragma omp parallel for schedule(guided)
+	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
+		c[i] = SemiRing::add(c[i], detail::rowTimesVector<SemiRing>(A, i, v));
+	}
 }
 
 /**
  * Computes the matrix-vector product of matrix @a A and Vector @a v and adds it to @a c where the add operation
  * is that of the specified binary function @a accum (i.e. c[i] = accum(c[i], (A*v)[i]). The default Semiring is the
- * ArithmeticSemiring.
+ * ArithmeticSemiring. @a v and @a c may be the same vector.
  * @param A
  * @param v
  * @param c
@@ -240,9 +320,44 @@ void MxV(const Matrix& A, const NetworKit::Vector& v, NetworKit::Vector& c, F ac
 	assert(A.numberOfColumns() == v.getDimension());
 	assert(A.getZero() == SemiRing::zero());
 
-	A.parallelForNonZeroElementsInRowOrder([&](NetworKit::index i, NetworKit::index j, double value) {
-		c[i] = accum(c[i], SemiRing::mult(value, v[j]));
-	});
+	if (&v == &c) {
+		NetworKit::Vector input = v;
+		MxV<SemiRing>(A, input, c, accum);
+		return;
+	}
+
+#pragma omp parallel for schedule(guided)
+	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
+		c[i] = accum(c[i], detail::rowTimesVector<SemiRing>(A, i, v));
+	}
+}
+
+/**
+ * Computes the matrix-vector product of matrix @a A and Vector @a v for the rows selected by @a mask. Row i is
+ * selected if mask[i] is non-zero, or, if @a complement is true, if mask[i] is zero. All other entries of the result
+ * are SemiRing::zero(). With a complemented mask of visited nodes this computes the next frontier of a traversal
+ * without touching the rows of visited nodes.
+ * @param A
+ * @param v
+ * @param mask
+ * @param complement
+ */
+template<class SemiRing = ArithmeticSemiring, class Matrix>
+NetworKit::Vector maskedMxV(const Matrix& A, const NetworKit::Vector& v, const NetworKit::Vector& mask, bool complement = false) {
+	assert(!v.isTransposed());
+	assert(A.numberOfColumns() == v.getDimension());
+	assert(A.numberOfRows() == mask.getDimension());
+	assert(A.getZero() == SemiRing::zero());
+	NetworKit::Vector result(A.numberOfRows(), A.getZero());
+
+#pragma omp parallel for schedule(guided)
+	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
+		if ((mask[i] != 0.0) != complement) {
+			result[i] = detail::rowTimesVector<SemiRing>(A, i, v);
+		}
+	}
+
+	return result;
 }
 
 /**
@@ -9,6 +9,7 @@
 #define NETWORKIT_CPP_ALGEBRAIC_SEMIRINGS_H_
 
 #include <algorithm>
+#include <limits>
 
 // *****************************************************
 // 					Semiring Definitions
@@ -196,6 +197,52 @@ public:
 	inline static double one() {return 1;};
 };
 
+// *****************************************************
+// 					Semiring Traits
+// *****************************************************
+
+/**
+ * @ingroup algebraic
+ * Compile-time properties of a semiring that specialised GraphBLAS kernels can exploit. If add has an absorbing
+ * element a (i.e. add(a, x) = a for all x), the accumulation of a row can stop as soon as a is reached.
+ * The default assumes no such element exists.
+ */
+template<class SemiRing>
+struct SemiringTraits {
+	static constexpr bool hasAddAnnihilator = false;
+	inline static double addAnnihilator() {return SemiRing::zero();};
+};
+
+template<>
+struct SemiringTraits<MinPlusSemiring> {
+	static constexpr bool hasAddAnnihilator = true;
+	inline static double addAnnihilator() {return -std::numeric_limits<double>::infinity();};
+};
+
+template<>
+struct SemiringTraits<MaxPlusSemiring> {
+	static constexpr bool hasAddAnnihilator = true;
+	inline static double addAnnihilator() {return std::numeric_limits<double>::infinity();};
+};
+
+template<>
+struct SemiringTraits<MinMaxSemiring> {
+	static constexpr bool hasAddAnnihilator = true;
+	inline static double addAnnihilator() {return -std::numeric_limits<double>::infinity();};
+};
+
+template<>
+struct SemiringTraits<MaxMinSemiring> {
+	static constexpr bool hasAddAnnihilator = true;
+	inline static double addAnnihilator() {return std::numeric_limits<double>::infinity();};
+};
+
+template<>
+struct SemiringTraits<IntLogicalSemiring> {
+	static constexpr bool hasAddAnnihilator = true;
+	inline static double addAnnihilator() {return 1;};
+};
+
 
 
 #endif /* NETWORKIT_CPP_ALGEBRAIC_SEMIRINGS_H_ */
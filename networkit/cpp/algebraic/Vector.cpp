@@ -9,6 +9,8 @@
 
 #include "DynamicMatrix.h"
 
+#include <algorithm>
+
 namespace NetworKit {
 
 Vector::Vector() : values(0), transposed(false) {}
@@ -35,6 +37,10 @@ double Vector::length() const {
 	return std::sqrt(innerProduct(*this, *this));
 }
 
+double Vector::squaredLength() const {
+	return innerProduct(*this, *this);
+}
+
 double Vector::mean() const {
 	double sum = 0.0;
 	this->forElements([&](double value){
@@ -60,11 +66,31 @@ bool Vector::operator!=(const Vector &other) const {
 
 double Vector::innerProduct(const Vector &v1, const Vector &v2) {
 	assert(v1.getDimension() == v2.getDimension());
-	double scalar = 0.0;
-	for (index i = 0; i < v1.getDimension(); ++i) {
-		scalar += v1[i] * v2[i];
+	// the sums of blocks of fixed size are added in block order, so the result does not depend on the number of threads
+	const count blockSize = 1 << 14;
+	const count n = v1.getDimension();
+	if (n <= blockSize) {
+		double scalar = 0.0;
+		for (index i = 0; i < n; ++i) {
+			scalar += v1[i] * v2[i];
+		}
+		return scalar;
 	}
 
+	std::vector<double> blockSums((n + blockSize - 1) / blockSize, 0.0);
+#pragma omp parallel for
+	for (index b = 0; b < blockSums.size(); ++b) {
+		double sum = 0.0;
+		for (index i = b * blockSize; i < std::min(n, (b + 1) * blockSize); ++i) {
+			sum += v1[i] * v2[i];
+		}
+		blockSums[b] = sum;
+	}
+
+	double scalar = 0.0;
+	for (double sum : blockSums) {
+		scalar += sum;
+	}
 	return scalar;
 }
 
@@ -154,6 +180,48 @@ Vector& Vector::operator-=(const double value) {
 	return *this;
 }
 
+Vector& Vector::axpy(const double alpha, const Vector &x) {
+	assert(isTransposed() == x.isTransposed()); // vectors must be transposed correctly
+	assert(getDimension() == x.getDimension()); // dimensions of vectors must match
+
+#pragma omp parallel for
+	for (count i = 0; i < getDimension(); ++i) {
+		values[i] += alpha * x[i];
+	}
+
+	return *this;
+}
+
+Vector& Vector::aypx(const double alpha, const Vector &x) {
+	assert(isTransposed() == x.isTransposed()); // vectors must be transposed correctly
+	assert(getDimension() == x.getDimension()); // dimensions of vectors must match
+
+#pragma omp parallel for
+	for (count i = 0; i < getDimension(); ++i) {
+		values[i] = x[i] + alpha * values[i];
+	}
+
+	return *this;
+}
+
+double Vector::axpyAndSquaredLength(const double alpha, const Vector &x) {
+	assert(isTransposed() == x.isTransposed()); // vectors must be transposed correctly
+	assert(getDimension() == x.getDimension()); // dimensions of vectors must match
+
+	double sqrLength = 0.0;
+#pragma omp parallel for reduction(+:sqrLength)
+	for (count i = 0; i < getDimension(); ++i) {
+		values[i] += alpha * x[i];
+		sqrLength += values[i] * values[i];
+	}
+
+	return sqrLength;
+}
+
+void Vector::fill(const double value) {
+	std::fill(values.begin(), values.end(), value);
+}
+
 
 } /* namespace NetworKit */
 
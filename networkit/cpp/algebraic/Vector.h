@@ -100,6 +100,12 @@ public:
 	 */
 	double mean() const;
 
+	/**
+	 * Calculates and returns the squared Euclidean length of this vector, which avoids the square root of @ref length.
+	 * @return The squared length of this vector.
+	 */
+	double squaredLength() const;
+
 	/**
 	 * Returns a reference to the element at index @a idx without checking the range of this vector.
 	 * @param idx The index of the element.
@@ -156,7 +162,8 @@ public:
 	static Matrix outerProduct(const Vector& v1, const Vector& v2);
 
 	/**
-	 * Computes the inner product (dot product) of the vectors @a v1 and @a v2.
+	 * Computes the inner product (dot product) of the vectors @a v1 and @a v2. Long vectors are summed in
+	 * parallel, the result is the same for any number of threads.
 	 * @return The result of the inner product.
 	 */
 	static double innerProduct(const Vector &v1, const Vector &v2);
@@ -248,6 +255,30 @@ public:
 	 */
 	Vector& operator-=(const double value);
 
+	/**
+	 * Adds @a alpha * @a x to this vector in place (y = alpha * x + y) without creating temporaries.
+	 * @return Reference to this vector.
+	 */
+	Vector& axpy(const double alpha, const Vector &x);
+
+	/**
+	 * Replaces this vector in place by @a x + @a alpha * this (y = x + alpha * y) without creating temporaries.
+	 * @return Reference to this vector.
+	 */
+	Vector& aypx(const double alpha, const Vector &x);
+
+	/**
+	 * Adds @a alpha * @a x to this vector in place and returns the squared length of the result. Both are computed
+	 * in the same pass over the data.
+	 * @return The squared length of the updated vector.
+	 */
+	double axpyAndSquaredLength(const double alpha, const Vector &x);
+
+	/**
+	 * Sets every entry of this vector to @a value, keeping the dimension and the allocated memory.
+	 */
+	void fill(const double value);
+
 	/**
 	 * Applies the unary function @a unaryElementFunction to each value in the Vector. Note that it must hold that the
 	 * function applied to the zero element of this matrix returns the zero element.
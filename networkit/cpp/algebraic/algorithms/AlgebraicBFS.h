@@ -27,7 +27,7 @@ public:
 	 * @param graph
 	 * @param source
 	 */
-	AlgebraicBFS(const Graph& graph, node source) : At(Matrix::adjacencyMatrix(graph, MinPlusSemiring::zero()).transpose()), source(source) {}
+	AlgebraicBFS(const Graph& graph, node source) : At(patternTranspose(graph)), source(source) {}
 
 	/**
 	 * Runs a bfs using the GraphBLAS interface from the source node.
@@ -48,6 +48,22 @@ private:
 	Matrix At;
 	node source;
 	Vector distances;
+
+	/**
+	 * Returns the transposed adjacency matrix of @a graph where every edge has value 1, i.e. row v lists the
+	 * in-neighbors of v. Edge weights are irrelevant for the BFS.
+	 */
+	static Matrix patternTranspose(const Graph& graph) {
+		std::vector<Triplet> triplets;
+		triplets.reserve(graph.isDirected() ? graph.numberOfEdges() : 2 * graph.numberOfEdges());
+		graph.forEdges([&](node u, node v) {
+			triplets.push_back({v, u, 1.0});
+			if (!graph.isDirected() && u != v) {
+				triplets.push_back({u, v, 1.0});
+			}
+		});
+		return Matrix(graph.upperNodeIdBound(), triplets, IntLogicalSemiring::zero());
+	}
 };
 
 template<class Matrix>
@@ -56,11 +72,25 @@ void AlgebraicBFS<Matrix>::run() {
 	distances = Vector(n, std::numeric_limits<double>::infinity());
 	distances[source] = 0;
 
-	Vector oldDist;
-	do {
-		oldDist = distances;
-		GraphBLAS::MxV<MinPlusSemiring>(At, distances, distances);
-	} while (oldDist != distances);
+	// level-synchronous BFS: the next frontier consists of the unvisited nodes with an in-neighbor in the frontier
+	Vector frontier(n, 0.0);
+	frontier[source] = 1;
+	Vector visited = frontier;
+	for (count level = 1; ; ++level) {
+		frontier = GraphBLAS::maskedMxV<IntLogicalSemiring>(At, frontier, visited, true);
+
+		bool expanded = false;
+#pragma omp parallel for reduction(||:expanded)
+		for (index v = 0; v < n; ++v) {
+			if (frontier[v] != 0.0) {
+				distances[v] = level;
+				visited[v] = 1;
+				expanded = true;
+			}
+		}
+
+		if (!expanded) break;
+	}
 
 	hasRun = true;
 }
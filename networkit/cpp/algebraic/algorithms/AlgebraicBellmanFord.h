@@ -70,12 +70,15 @@ void AlgebraicBellmanFord<Matrix>::run() {
 	distances = Vector(n, std::numeric_limits<double>::infinity());
 	distances[source] = 0;
 
-	for (index k = 1; k < n; ++k) {
-		GraphBLAS::MxV<MinPlusSemiring>(At, distances, distances);
-	}
+	// at most n rounds; if the distances still change in round n, there is a negative cycle
+	Vector oldDist;
+	count round = 0;
+	do {
+		oldDist = distances;
+		GraphBLAS::MxV<MinPlusSemiring>(At, oldDist, distances);
+		++round;
+	} while (round < n && oldDist != distances);
 
-	Vector oldDist = distances;
-	GraphBLAS::MxV<MinPlusSemiring>(At, distances, distances);
 	negCycle = (oldDist != distances);
 	hasRun = true;
 }
@@ -11,6 +11,7 @@
 #include "../../../graph/BFS.h"
 #include "../AlgebraicBFS.h"
 #include "../../../io/METISGraphReader.h"
+#include "../../../generators/ErdosRenyiGenerator.h"
 
 #include "../../../auxiliary/Timer.h"
 
@@ -63,6 +64,24 @@ TEST(AlgebraicBFSGTest, testOnToyGraph) {
 	EXPECT_EQ(3, bfs.distance(6));
 }
 
+TEST(AlgebraicBFSGTest, testAgainstBFS) {
+	for (bool directed : {false, true}) {
+		Graph G = ErdosRenyiGenerator(500, 0.004, directed).generate();
+		BFS bfs(G, 0, false);
+		bfs.run();
+		AlgebraicBFS<CSRMatrix> algebraicBfs(G, 0);
+		algebraicBfs.run();
+
+		G.forNodes([&](node u) {
+			if (algebraicBfs.distance(u) == std::numeric_limits<double>::infinity()) {
+				EXPECT_EQ(bfs.distance(u), std::numeric_limits<double>::max());
+			} else {
+				EXPECT_EQ(bfs.distance(u), algebraicBfs.distance(u));
+			}
+		});
+	}
+}
+
 TEST(AlgebraicBFSGTest, benchmarkBFS) {
 	METISGraphReader reader;
 	Graph G = reader.read("input/caidaRouterLevel.graph");
@@ -7,6 +7,7 @@
 
 #include "GraphBLASGTest.h"
 #include "../CSRMatrix.h"
+#include "../DynamicMatrix.h"
 #include <iostream>
 namespace NetworKit {
 
@@ -223,6 +224,76 @@ TEST_F(GraphBLASGTest, testMxV) {
 	EXPECT_EQ(2, res[3]);
 }
 
+TEST_F(GraphBLASGTest, testMaskedMxV) {
+	//		  1  1  0  0
+	//        0  0  1  0
+	// mat  = 0  0  0  1
+	//		  1  0  0  0
+	std::vector<Triplet> triplets = {{0,0,1}, {0,1,1}, {1,2,1}, {2,3,1}, {3,0,1}};
+	CSRMatrix mat(4, triplets);
+
+	Vector frontier = {1, 0, 0, 1};
+	Vector visited = {1, 1, 0, 0};
+
+	Vector next = GraphBLAS::maskedMxV<IntLogicalSemiring>(mat, frontier, visited, true);
+	EXPECT_EQ(0, next[0]); // masked out although row 0 has a frontier neighbor
+	EXPECT_EQ(0, next[1]);
+	EXPECT_EQ(1, next[2]);
+	EXPECT_EQ(1, next[3]);
+
+	next = GraphBLAS::maskedMxV<IntLogicalSemiring>(mat, frontier, visited);
+	EXPECT_EQ(1, next[0]);
+	EXPECT_EQ(0, next[1]);
+	EXPECT_EQ(0, next[2]);
+	EXPECT_EQ(0, next[3]);
+
+	// unmasked rows agree with MxV
+	Vector v = {1, 2, 3, 4};
+	Vector full = GraphBLAS::MxV(mat, v);
+	Vector all = GraphBLAS::maskedMxV(mat, v, Vector(4, 1.0));
+	EXPECT_EQ(full, all);
+
+	// in-place accumulation reads the old values only
+	Vector c = {0, 1, 2, 3};
+	GraphBLAS::MxV(mat, c, c);
+	EXPECT_EQ(1, c[0]);
+	EXPECT_EQ(3, c[1]);
+	EXPECT_EQ(5, c[2]);
+	EXPECT_EQ(3, c[3]);
+}
+
+TEST_F(GraphBLASGTest, testCSRMxMKernel) {
+	std::vector<Triplet> tripletsA;
+	std::vector<Triplet> tripletsB;
+	for (index i = 0; i < 60; ++i) {
+		for (index j = 0; j < 40; ++j) {
+			if ((i * 7 + j * 3) % 5 == 0) tripletsA.push_back({i, j, (double) ((i + j) % 9)});
+			if ((i * 3 + j) % 4 == 0 && i < 40) tripletsB.push_back({i, j + (i % 3), (double) (i % 7) - 2});
+		}
+	}
+
+	CSRMatrix A(60, 40, tripletsA, MinPlusSemiring::zero());
+	CSRMatrix B(40, 42, tripletsB, MinPlusSemiring::zero());
+	DynamicMatrix dA(60, 40, tripletsA, MinPlusSemiring::zero());
+	DynamicMatrix dB(40, 42, tripletsB, MinPlusSemiring::zero());
+
+	CSRMatrix C = GraphBLAS::MxM<MinPlusSemiring>(A, B);
+	DynamicMatrix dC = GraphBLAS::MxM<MinPlusSemiring>(dA, dB);
+	ASSERT_EQ(60u, C.numberOfRows());
+	ASSERT_EQ(42u, C.numberOfColumns());
+	EXPECT_TRUE(C.sorted());
+	EXPECT_EQ(dC.nnz(), C.nnz());
+	dC.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+		EXPECT_EQ(value, C(i, j));
+	});
+
+	CSRMatrix P = GraphBLAS::MxM(CSRMatrix(60, 40, tripletsA), CSRMatrix(40, 42, tripletsB));
+	DynamicMatrix dP = GraphBLAS::MxM(DynamicMatrix(60, 40, tripletsA), DynamicMatrix(40, 42, tripletsB));
+	dP.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+		EXPECT_EQ(value, P(i, j));
+	});
+}
+
 TEST_F(GraphBLASGTest, testEWiseAdd) {
 	std::vector<Triplet> triplets1;
 	std::vector<Triplet> triplets2;
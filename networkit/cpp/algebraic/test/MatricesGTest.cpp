@@ -10,6 +10,7 @@
 #include "../CSRMatrix.h"
 #include "../DenseMatrix.h"
 #include "../DynamicMatrix.h"
+#include "../../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -120,4 +121,80 @@ TEST_F(MatricesGTest, testLaplacianMatrixOfGraph) {
 	testLaplacianOfGraph<CSRMatrix>();
 }
 
+TEST_F(MatricesGTest, testCSRMatrixParallelKernels) {
+	count nRows = 300;
+	count nCols = 200;
+	std::vector<Triplet> triplets;
+	for (index i = 0; i < nRows; ++i) {
+		count entries = (i % 10 == 0) ? 50 : 3; // a few heavy rows
+		for (index k = 0; k < entries; ++k) {
+			index j = Aux::Random::integer(nCols-1);
+			bool present = false;
+			for (const Triplet& t : triplets) {
+				if (t.row == i && t.column == j) present = true;
+			}
+			if (!present) triplets.push_back({i, j, Aux::Random::real(-1.0, 1.0)});
+		}
+	}
+	CSRMatrix A(nRows, nCols, triplets);
+	DenseMatrix D(nRows, nCols);
+	for (const Triplet& t : triplets) {
+		D.setValue(t.row, t.column, t.value);
+	}
+
+	CSRMatrix At = A.transpose();
+	EXPECT_TRUE(At.sorted());
+	ASSERT_EQ(nCols, At.numberOfRows());
+	ASSERT_EQ(nRows, At.numberOfColumns());
+	EXPECT_EQ(A.nnz(), At.nnz());
+	for (index j = 0; j < nCols; ++j) {
+		index last = 0;
+		bool first = true;
+		At.forNonZeroElementsInRow(j, [&](index i, double value) {
+			EXPECT_TRUE(first || last < i);
+			EXPECT_EQ(D(i, j), value);
+			last = i;
+			first = false;
+		});
+	}
+
+	CSRMatrix AtA = CSRMatrix::mTmMultiply(A, A);
+	CSRMatrix AAt = CSRMatrix::mmTMultiply(A, A);
+	for (index i = 0; i < nCols; ++i) {
+		for (index j = 0; j < nCols; ++j) {
+			double expected = 0.0;
+			for (index k = 0; k < nRows; ++k) {
+				expected += D(k, i) * D(k, j);
+			}
+			EXPECT_NEAR(expected, AtA(i, j), 1e-12);
+		}
+	}
+	for (index i = 0; i < nRows; i += 7) {
+		for (index j = 0; j < nRows; ++j) {
+			double expected = 0.0;
+			for (index k = 0; k < nCols; ++k) {
+				expected += D(i, k) * D(j, k);
+			}
+			EXPECT_NEAR(expected, AAt(i, j), 1e-12);
+		}
+	}
+
+	Vector x(nRows);
+	for (index i = 0; i < nRows; ++i) {
+		x[i] = Aux::Random::real();
+	}
+	Vector y = CSRMatrix::mTvMultiply(A, x);
+	Vector z = At * x;
+	for (index j = 0; j < nCols; ++j) {
+		EXPECT_NEAR(z[j], y[j], 1e-12);
+	}
+
+	// unsorted operands take the sparse accumulator path of binaryOperator
+	CSRMatrix sum = A + A;
+	EXPECT_EQ(A.nnz(), sum.nnz());
+	A.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+		EXPECT_EQ(2 * value, sum(i, j));
+	});
+}
+
 } /* namespace NetworKit */
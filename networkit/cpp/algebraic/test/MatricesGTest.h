@@ -779,6 +779,14 @@ void MatricesGTest::testMatrixVectorProduct() {
 	EXPECT_EQ(12, res[2]);
 	EXPECT_EQ(-3, res[3]);
 
+	// in-place product overwrites stale content and resizes if necessary
+	Vector inPlace(4, 100.0);
+	mat2.multiply(v, inPlace);
+	EXPECT_EQ(res, inPlace);
+	Vector wrongSize(7, 1.0);
+	mat2.multiply(v, wrongSize);
+	EXPECT_EQ(res, wrongSize);
+
 	// rectangular matrix
 	//
 	// 1 0 0 0 0
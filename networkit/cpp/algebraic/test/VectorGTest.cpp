@@ -9,6 +9,8 @@
 #include "VectorGTest.h"
 #include "../AlgebraicGlobals.h"
 
+#include <omp.h>
+
 namespace NetworKit {
 
 VectorGTest::VectorGTest() {
@@ -103,6 +105,20 @@ TEST(VectorGTest, testInnerProduct) {
 
 	dotProduct = Vector::innerProduct(v1, v2);
 	EXPECT_EQ(8.0, dotProduct);
+
+	// long vectors are summed in parallel, independently of the number of threads
+	count n = 100000;
+	Vector v4(n), v5(n);
+	for (index i = 0; i < n; ++i) {
+		v4[i] = 1.0 / (i + 1);
+		v5[i] = (i % 2 == 0) ? 1.0 : -0.5;
+	}
+	int threads = omp_get_max_threads();
+	dotProduct = Vector::innerProduct(v4, v5);
+	omp_set_num_threads(1);
+	double sequential = Vector::innerProduct(v4, v5);
+	omp_set_num_threads(threads);
+	EXPECT_EQ(sequential, dotProduct);
 }
 
 TEST(VectorGTest, testVectorComparisonOperators) {
@@ -249,6 +265,39 @@ TEST(VectorGTest, testMean) {
 	EXPECT_EQ(mean, 3);
 }
 
+TEST(VectorGTest, testInPlaceOperations) {
+	Vector x = {1.0, 2.0, 3.0, 4.0};
+	Vector y = {4.0, 3.0, 2.0, 1.0};
+
+	EXPECT_EQ(30.0, x.squaredLength());
+
+	y.axpy(2.0, x); // y = 2x + y
+	EXPECT_EQ(Vector({6.0, 7.0, 8.0, 9.0}), y);
+
+	y.aypx(-1.0, x); // y = x - y
+	EXPECT_EQ(Vector({-5.0, -5.0, -5.0, -5.0}), y);
+
+	double sqrLength = y.axpyAndSquaredLength(1.0, x); // y = x + y
+	EXPECT_EQ(Vector({-4.0, -3.0, -2.0, -1.0}), y);
+	EXPECT_EQ(30.0, sqrLength);
+
+	y.fill(0.5);
+	EXPECT_EQ(Vector({0.5, 0.5, 0.5, 0.5}), y);
+
+	// agrees with the allocating operators on a larger vector
+	Vector a(10000), b(10000);
+	for (index i = 0; i < a.getDimension(); ++i) {
+		a[i] = std::sin(i);
+		b[i] = std::cos(i);
+	}
+	Vector expected = b + 0.25 * a;
+	sqrLength = b.axpyAndSquaredLength(0.25, a);
+	for (index i = 0; i < a.getDimension(); ++i) {
+		EXPECT_DOUBLE_EQ(expected[i], b[i]);
+	}
+	EXPECT_NEAR(expected.length() * expected.length(), sqrLength, 1e-8);
+}
+
 
 } /* namespace NetworKit */
 
@@ -11,6 +11,7 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <random>
 #include <stdexcept>
 #include "Log.h"
@@ -111,6 +112,123 @@ const Element& weightedChoice(const std::vector<std::pair<Element, double>>& wei
 	throw std::runtime_error("Random::weightedChoice: should never get here"); // should never get here
 }
 
+/**
+ * @returns a weighted random choice from a vector of elements with given weights,
+ * using the random number generator @a urng instead of the thread-local one.
+ */
+template <typename Element, typename URNG>
+const Element& weightedChoice(const std::vector<std::pair<Element, double>>& weightedElements, URNG& urng) {
+	if (weightedElements.size() == 0)
+		throw std::runtime_error("Random::weightedChoice: input size equal to 0");
+	double total = 0.0;
+	for (const auto& entry : weightedElements) {
+		assert(entry.second >= 0.0 && "This algorithm only works with non-negative weights");
+		total += entry.second;
+	}
+	double r = std::uniform_real_distribution<double>{0.0, total}(urng);
+	for (const auto& entry : weightedElements) {
+		if (r < entry.second) {
+			return entry.first;
+		}
+		r -= entry.second;
+	}
+	throw std::runtime_error("Random::weightedChoice: should never get here"); // should never get here
+}
+
+
+/**
+ * Splittable random number generator following SplitMix64 (Steele, Lea, Flood:
+ * "Fast splittable pseudorandom number generators", OOPSLA 2014).
+ *
+ * The state is a single 64 bit word, so creating a generator per node, per
+ * iteration or per task is cheap. Every (seed, streamId) pair identifies a
+ * reproducible stream, which makes the results of parallel loops independent of
+ * the thread schedule:
+ *
+ *     uint64_t seed = Aux::Random::integer(); // once, outside of the parallel region
+ *     #pragma omp parallel for
+ *     for (index i = 0; i < n; ++i) {
+ *         Aux::Random::SplitMix64 urng(seed, i);
+ *         ...
+ *     }
+ *
+ * If Aux::Random::setSeed has been called, the seed drawn this way and therefore
+ * all streams are the same in every run, regardless of the number of threads.
+ * SplitMix64 satisfies the requirements of a uniform random number generator and
+ * can be used with the distributions of <random>.
+ */
+class SplitMix64 {
+public:
+	typedef uint64_t result_type;
+
+	/**
+	 * @param seed The seed value
+	 */
+	explicit SplitMix64(uint64_t seed = 0) : state(seed) {}
+
+	/**
+	 * Creates the stream @a streamId of the family of streams identified by @a seed.
+	 */
+	SplitMix64(uint64_t seed, uint64_t streamId) : state(mix(seed ^ mix(streamId + gamma))) {}
+
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+	result_type operator()() {
+		state += gamma;
+		return mix(state);
+	}
+
+	/**
+	 * @returns the child stream @a streamId of this generator. Does not advance this generator,
+	 * so e.g. a task can hand out one child per iteration of a nested loop.
+	 */
+	SplitMix64 split(uint64_t streamId) const {
+		return SplitMix64(state, streamId);
+	}
+
+	/**
+	 * @returns a double distributed uniformly in the half-open range [0, 1)
+	 */
+	double real() {
+		return ((*this)() >> 11) * (1.0 / (UINT64_C(1) << 53));
+	}
+
+	/**
+	 * @returns a double distributed uniformly in the range [0, 1]
+	 */
+	double probability() {
+		return ((*this)() >> 11) * (1.0 / ((UINT64_C(1) << 53) - 1));
+	}
+
+	/**
+	 * @returns an integer distributed uniformly in the inclusive range [0, upperBound]
+	 */
+	uint64_t integer(uint64_t upperBound) {
+		std::uniform_int_distribution<uint64_t> dist{0, upperBound};
+		return dist(*this);
+	}
+
+	/**
+	 * @returns a size_t in the range [0, max - 1]
+	 */
+	std::size_t index(std::size_t max) {
+		assert(max > 0 && "There have to be valid indexes");
+		return integer(max - 1);
+	}
+
+private:
+	static constexpr uint64_t gamma = UINT64_C(0x9E3779B97F4A7C15);
+
+	uint64_t state;
+
+	static uint64_t mix(uint64_t z) {
+		z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+		z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+		return z ^ (z >> 31);
+	}
+};
+
 } // namespace Random
 } // namespace Aux
 
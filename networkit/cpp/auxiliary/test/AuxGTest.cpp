@@ -355,6 +355,48 @@ TEST_F(AuxGTest, testRandomIndex) {
 	}
 }
 
+TEST_F(AuxGTest, testSplitMix64) {
+	using Aux::Random::SplitMix64;
+	const uint64_t seed = 42;
+	const int n = 1000;
+
+	// the same stream of the same family is reproduced
+	std::vector<uint64_t> first(n), second(n);
+	#pragma omp parallel for
+	for (int i = 0; i < n; ++i) {
+		first[i] = SplitMix64(seed, i)();
+	}
+	for (int i = 0; i < n; ++i) {
+		second[i] = SplitMix64(seed, i)();
+	}
+	EXPECT_EQ(first, second);
+
+	// different streams and different seeds differ
+	std::set<uint64_t> distinct(first.begin(), first.end());
+	EXPECT_EQ((size_t) n, distinct.size());
+	EXPECT_NE(SplitMix64(seed, 0)(), SplitMix64(seed + 1, 0)());
+
+	// splitting does not advance the parent
+	SplitMix64 parent(seed);
+	EXPECT_EQ(parent.split(3)(), parent.split(3)());
+	EXPECT_NE(parent.split(3)(), parent.split(4)());
+
+	SplitMix64 urng(seed, 7);
+	double sum = 0.0;
+	for (int i = 0; i < n; ++i) {
+		double r = urng.real();
+		EXPECT_GE(r, 0.0);
+		EXPECT_LT(r, 1.0);
+		double p = urng.probability();
+		EXPECT_GE(p, 0.0);
+		EXPECT_LE(p, 1.0);
+		EXPECT_LE(urng.integer(10), 10u);
+		EXPECT_LT(urng.index(10), 10u);
+		sum += r;
+	}
+	EXPECT_NEAR(0.5, sum / n, 0.05);
+}
+
 TEST_F(AuxGTest, testSplit) {
 	using Vec = std::vector<std::string>;
 	using namespace Aux::StringTools;
@@ -53,17 +53,20 @@ void ApproxBetweenness::run() {
 	std::vector<std::vector<double> > scorePerThread(maxThreads, std::vector<double>(G.upperNodeIdBound()));
 	DEBUG("score per thread size: ", scorePerThread.size());
 	handler.assureRunning();
+	// each sample draws from its own random stream, so the result does not depend on the thread schedule
+	const uint64_t seed = Aux::Random::integer();
 	#pragma omp parallel for
 	for (count i = 1; i <= r; i++) {
 		count thread = omp_get_thread_num();
+		Aux::Random::SplitMix64 urng(seed, i);
 		DEBUG("sample ", i);
 		// if (i >= 1000) throw std::runtime_error("too many iterations");
 		// DEBUG
 		// sample random node pair
 		node u, v;
-		u = Sampling::randomNode(G);
+		u = Sampling::randomNode(G, urng);
 		do {
-			v = Sampling::randomNode(G);
+			v = Sampling::randomNode(G, urng);
 		} while (v == u);
 
 		// runs faster for unweighted graphs
@@ -91,10 +94,10 @@ void ApproxBetweenness::run() {
 					tmp.ToDouble(weight);
 					choices.emplace_back(z, weight); 	// sigma_uz / sigma_us
 				}
-				node z = Aux::Random::weightedChoice(choices);
+				node z = Aux::Random::weightedChoice(choices, urng);
 				assert (z <= G.upperNodeIdBound());
 				if (z != u) {
-					scorePerThread[thread][z] += 1 / (double) r;
+					scorePerThread[thread][z] += 1; // sums of integers are exact, independent of the order
 				}
 				// s = t;
 				t = z;
@@ -110,6 +113,9 @@ void ApproxBetweenness::run() {
 			scoreData[v] += local[v];
 		});
 	}
+	G.parallelForNodes([&](node v){
+		scoreData[v] /= (double) r;
+	});
 
 	hasRun = true;
 }
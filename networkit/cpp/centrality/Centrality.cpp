@@ -38,6 +38,11 @@ std::vector<double> Centrality::scores(bool moveOut) {
 	return moveOut ? std::move(scoreData) :  scoreData;
 }
 
+const std::vector<double>& Centrality::scoresView() const {
+	if (!hasRun) throw std::runtime_error("Call run method first");
+	return scoreData;
+}
+
 std::vector<double> Centrality::edgeScores() {
 	if (!hasRun) throw std::runtime_error("Call run method first");
 	return edgeScoreData;
@@ -44,6 +44,13 @@ public:
 	 */
 	virtual std::vector<double> scores(bool moveOut = false);
 
+	/**
+	 * Get the scores calculated by @link run() without copying them. The scores are stored contiguously,
+	 * indexed by node, and the reference stays valid until the algorithm is run again.
+	 * @return The internal vector of scores.
+	 */
+	const std::vector<double>& scoresView() const;
+
 	/**
 	 * Get a vector containing the edge betweenness score for each edge in the graph.
 	 * @return The edge betweenness scores calculated by @link run().
@@ -40,9 +40,9 @@ void Closeness::run() {
 	G.parallelForNodes([&](node s) {
 		std::unique_ptr<SSSP> sssp;
 		if (G.isWeighted()) {
-			sssp.reset(new Dijkstra(G, s, true, true));
+			sssp.reset(new Dijkstra(G, s, false, false));
 		} else {
-			sssp.reset(new BFS(G, s, true, true));
+			sssp.reset(new BFS(G, s, false, false));
 		}
 		sssp->run();
 
@@ -6,66 +6,23 @@
  */
 
 #include "EigenvectorCentrality.h"
-#include "../auxiliary/NumericTools.h"
+#include "PowerIteration.h"
+
+#include <cmath>
 
 namespace NetworKit {
 
-EigenvectorCentrality::EigenvectorCentrality(const Graph& G, double tol):
-		Centrality(G, true), tol(tol)
+EigenvectorCentrality::EigenvectorCentrality(const Graph& G, double tol, bool singlePrecision):
+		Centrality(G, true), tol(tol), singlePrecision(singlePrecision)
 {
 
 }
 
 void EigenvectorCentrality::run() {
-	count z = G.upperNodeIdBound();
-	std::vector<double> values(z, 1.0);
-	scoreData = values;
-
-	double length = 0.0;
-	double oldLength = 0.0;
-
-	auto converged([&](double val, double other) {
-		// compute residual
-		return (Aux::NumericTools::equal(val, other, tol));
-	});
-
-	do {
-		oldLength = length;
-
-		// iterate matrix-vector product
-		G.parallelForNodes([&](node u) {
-			values[u] = 0.0;
-			G.forInEdgesOf(u, [&](node u, node v, edgeweight ew) {
-				values[u] += ew * scoreData[v];
-			});
-		});
-
-//		// set everything very small to zero
-//		G.parallelForNodes([&](node u) {
-//			if (values[u] < 1e-16) {
-//				values[u] = 0.0;
-//			}
-//		});
-
-		// normalize values
-		length = 0.0;
-		length = G.parallelSumForNodes([&](node u) {
-			return (values[u] * values[u]);
-		});
-		length = sqrt(length);
-
-//		TRACE("length: ", length);
-//		TRACE(values);
-
-		assert(! Aux::NumericTools::equal(length, 1e-16));
-		G.parallelForNodes([&](node u) {
-			values[u] /= length;
-		});
-
-//		TRACE(values);
-
-		scoreData = values;
-	} while (! converged(length, oldLength));
+	PowerIteration iteration(G, 1.0, 0.0, true, tol);
+	iteration.setSinglePrecision(singlePrecision);
+	iteration.run();
+	scoreData = iteration.getValues();
 
 	// check sign and correct if necessary
 	if (scoreData[0] < 0) {
@@ -20,6 +20,7 @@ namespace NetworKit {
 class EigenvectorCentrality: public Centrality {
 protected:
 	double tol; // error tolerance
+	bool singlePrecision;
 
 public:
 	/**
@@ -27,8 +28,9 @@ public:
 	 *
 	 * @param[in] G The graph.
 	 * @param[in] tol The tolerance for convergence.
+	 * @param[in] singlePrecision Iterate in single precision, see PowerIteration.
 	 */
-	EigenvectorCentrality(const Graph& G, double tol = 1e-8);
+	EigenvectorCentrality(const Graph& G, double tol = 1e-8, bool singlePrecision = false);
 
 	virtual void run();
 };
@@ -0,0 +1,293 @@
+/*
+ * KadabraBetweenness.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "KadabraBetweenness.h"
+#include "../auxiliary/Random.h"
+#include "../auxiliary/Log.h"
+#include "../auxiliary/SignalHandling.h"
+#include "../distance/Diameter.h"
+#include "../graph/Sampling.h"
+
+#include <math.h>
+#include <algorithm>
+#include <omp.h>
+
+namespace NetworKit {
+
+namespace {
+
+/**
+ * State of the two searches of a bidirectional BFS. Side 0 searches forward from the source, side 1 backward
+ * from the target. Only the entries of reached nodes are reset.
+ */
+struct SampleSpace {
+	std::vector<count> distance[2];
+	std::vector<double> paths[2];
+	std::vector<node> reached[2];
+	std::vector<node> frontier[2];
+	std::vector<node> next;
+	std::vector<node> meeting;
+
+	explicit SampleSpace(count z) {
+		for (index side = 0; side < 2; ++side) {
+			distance[side].assign(z, none);
+			paths[side].assign(z, 0);
+		}
+	}
+};
+
+template<typename L>
+void forSideNeighborsOf(const Graph& G, index side, node u, L handle) {
+	if (side == 0) {
+		G.forNeighborsOf(u, handle);
+	} else {
+		G.forInNeighborsOf(u, handle);
+	}
+}
+
+/**
+ * Appends the inner nodes of a shortest path from @a s to @a t, chosen uniformly at random, to @a pathNodes.
+ * Nothing is appended if @a t is not reachable from @a s.
+ */
+void samplePath(const Graph& G, node s, node t, SampleSpace& space, Aux::Random::SplitMix64& urng, std::vector<node>& pathNodes) {
+	const node endpoint[2] = {s, t};
+	for (index side = 0; side < 2; ++side) {
+		for (node v : space.reached[side]) {
+			space.distance[side][v] = none;
+		}
+		space.reached[side].assign(1, endpoint[side]);
+		space.frontier[side].assign(1, endpoint[side]);
+		space.distance[side][endpoint[side]] = 0;
+		space.paths[side][endpoint[side]] = 1;
+	}
+
+	// expand whole levels of the side whose frontier has fewer edges until the searches meet
+	index x;
+	space.meeting.clear();
+	while (space.meeting.empty()) {
+		if (space.frontier[0].empty() || space.frontier[1].empty()) {
+			return;
+		}
+		count edges[2] = {0, 0};
+		for (node u : space.frontier[0]) {
+			edges[0] += G.degreeOut(u);
+		}
+		for (node u : space.frontier[1]) {
+			edges[1] += G.degreeIn(u);
+		}
+		x = edges[0] <= edges[1] ? 0 : 1;
+		std::vector<count>& distance = space.distance[x];
+		std::vector<double>& paths = space.paths[x];
+		const std::vector<count>& otherDistance = space.distance[1 - x];
+		space.next.clear();
+		for (node u : space.frontier[x]) {
+			forSideNeighborsOf(G, x, u, [&](node v) {
+				if (distance[v] == none) {
+					distance[v] = distance[u] + 1;
+					paths[v] = paths[u];
+					space.next.push_back(v);
+					space.reached[x].push_back(v);
+					if (otherDistance[v] != none) {
+						space.meeting.push_back(v);
+					}
+				} else if (distance[v] == distance[u] + 1) {
+					paths[v] += paths[u];
+				}
+			});
+		}
+		space.frontier[x].swap(space.next);
+	}
+
+	// every shortest path contains exactly one of the meeting nodes, which lie on the last level of both searches
+	double total = 0;
+	for (node v : space.meeting) {
+		total += space.paths[0][v] * space.paths[1][v];
+	}
+	double r = urng.real() * total;
+	node middle = space.meeting.back();
+	for (node v : space.meeting) {
+		r -= space.paths[0][v] * space.paths[1][v];
+		if (r < 0) {
+			middle = v;
+			break;
+		}
+	}
+	if (middle != s && middle != t) {
+		pathNodes.push_back(middle);
+	}
+
+	// walk back to both endpoints, choosing each predecessor with probability proportional to its number of paths
+	for (index side = 0; side < 2; ++side) {
+		const std::vector<count>& distance = space.distance[side];
+		const std::vector<double>& paths = space.paths[side];
+		node current = middle;
+		while (distance[current] > 1) {
+			double r = urng.real() * paths[current];
+			node chosen = none;
+			forSideNeighborsOf(G, 1 - side, current, [&](node u) {
+				if (chosen == none && distance[u] + 1 == distance[current]) {
+					r -= paths[u];
+					if (r < 0) {
+						chosen = u;
+					}
+				}
+			});
+			if (chosen == none) {
+				// rounding left r slightly positive, take the last predecessor
+				forSideNeighborsOf(G, 1 - side, current, [&](node u) {
+					if (distance[u] + 1 == distance[current]) {
+						chosen = u;
+					}
+				});
+			}
+			current = chosen;
+			pathNodes.push_back(current);
+		}
+	}
+}
+
+} /* anonymous namespace */
+
+KadabraBetweenness::KadabraBetweenness(const Graph& G, const double epsilon, const double delta, const count k) : Centrality(G, true), epsilon(epsilon), delta(delta), k(k), tau(0), omega(0) {
+	if (G.isWeighted()) {
+		throw std::runtime_error("KadabraBetweenness can only deal with unweighted graphs, use ApproxBetweenness instead");
+	}
+	if (epsilon <= 0 || delta <= 0 || delta >= 1) {
+		throw std::runtime_error("epsilon has to be positive and delta in (0, 1)");
+	}
+}
+
+bool KadabraBetweenness::enoughSamples(const std::vector<count>& counts, double logInverseDelta) const {
+	// bounds on the deviation of the estimate b from below and above, both increasing in b
+	const double ratio = (double) omega / tau;
+	auto lower = [&](double b) {
+		return logInverseDelta / tau * (1.0 / 3 - ratio + sqrt((1.0 / 3 - ratio) * (1.0 / 3 - ratio) + 2 * b * omega / logInverseDelta));
+	};
+	auto upper = [&](double b) {
+		return logInverseDelta / tau * (1.0 / 3 + ratio + sqrt((1.0 / 3 + ratio) * (1.0 / 3 + ratio) + 2 * b * omega / logInverseDelta));
+	};
+	auto estimate = [&](node v) {
+		return (double) counts[v] / tau;
+	};
+	auto withinError = [&](node v) {
+		double b = estimate(v);
+		return lower(b) < epsilon && upper(b) < epsilon;
+	};
+
+	if (k == 0) {
+		// the node with the highest estimate has the widest bounds
+		double b = (double) *std::max_element(counts.begin(), counts.end()) / tau;
+		return lower(b) < epsilon && upper(b) < epsilon;
+	}
+
+	// every one of the first k nodes is within the error or separated from its neighbors in the ranking,
+	// and the (k+1)-th node, which bounds all nodes below, is within the error or below the k-th node
+	std::vector<node> ranking = G.nodes();
+	count size = std::min(k + 1, (count) ranking.size());
+	std::partial_sort(ranking.begin(), ranking.begin() + size, ranking.end(), [&](node a, node b) {
+		return counts[a] > counts[b] || (counts[a] == counts[b] && a < b);
+	});
+	auto separated = [&](node above, node below) {
+		return estimate(above) - lower(estimate(above)) > estimate(below) + upper(estimate(below));
+	};
+	for (index i = 0; i < size; ++i) {
+		node v = ranking[i];
+		if (withinError(v)) {
+			continue;
+		}
+		bool certain = i == 0 || separated(ranking[i - 1], v);
+		if (i < k && i + 1 < size) {
+			certain = certain && separated(v, ranking[i + 1]);
+		}
+		if (!certain) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void KadabraBetweenness::run() {
+	Aux::SignalHandler handler;
+	const count z = G.upperNodeIdBound();
+	const count n = G.numberOfNodes();
+	scoreData.clear();
+	scoreData.resize(z);
+	tau = 0;
+	omega = 0;
+	if (n < 3) {
+		hasRun = true;
+		return;
+	}
+
+	// the maximum number of samples for an additive error epsilon with probability 1 - delta/2
+	edgeweight vd = n;
+	if (!G.isDirected()) {
+		Diameter diam(G, DiameterAlgo::estimatedPedantic);
+		diam.run();
+		vd = diam.getDiameter().first;
+	}
+	if (vd <= 2) {
+		hasRun = true;
+		return;
+	}
+	omega = ceil((0.5 / (epsilon * epsilon)) * (floor(log2(vd - 2)) + 1 + log(2 / delta)));
+	// the remaining delta/2 is split among the lower and upper bounds of all nodes
+	const double logInverseDelta = log(4.0 * n / delta);
+	INFO("at most ", omega, " path samples");
+
+	count maxThreads = omp_get_max_threads();
+	std::vector<SampleSpace> spaces(maxThreads, SampleSpace(z));
+	std::vector<std::vector<node>> pathNodes(maxThreads);
+	std::vector<count> counts(z, 0);
+	// each sample draws from its own random stream and the rounds do not depend on the threads,
+	// so the result does not depend on the thread schedule
+	const uint64_t seed = Aux::Random::integer();
+	while (tau < omega) {
+		handler.assureRunning();
+		count round = std::min(omega - tau, std::max<count>(1000, tau / 8));
+		#pragma omp parallel for schedule(dynamic, 16)
+		for (index i = tau; i < tau + round; ++i) {
+			index thread = omp_get_thread_num();
+			Aux::Random::SplitMix64 urng(seed, i);
+			node s = Sampling::randomNode(G, urng);
+			node t;
+			do {
+				t = Sampling::randomNode(G, urng);
+			} while (t == s);
+			samplePath(G, s, t, spaces[thread], urng, pathNodes[thread]);
+		}
+
+		// aggregate the thread-local path nodes
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (index thread = 0; thread < maxThreads; ++thread) {
+			for (node v : pathNodes[thread]) {
+				#pragma omp atomic update
+				++counts[v];
+			}
+			pathNodes[thread].clear();
+		}
+		tau += round;
+		if (enoughSamples(counts, logInverseDelta)) {
+			break;
+		}
+	}
+	INFO("took ", tau, " path samples");
+
+	G.parallelForNodes([&](node v) {
+		scoreData[v] = (double) counts[v] / tau;
+	});
+	hasRun = true;
+}
+
+count KadabraBetweenness::numberOfSamples() const {
+	return tau;
+}
+
+count KadabraBetweenness::maximumNumberOfSamples() const {
+	return omega;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,67 @@
+/*
+ * KadabraBetweenness.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef KADABRABETWEENNESS_H_
+#define KADABRABETWEENNESS_H_
+
+#include "Centrality.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Approximation of betweenness centrality by adaptive sampling according to the algorithm described in
+ * Michele Borassi and Emanuele Natale: KADABRA is an ADaptive Algorithm for Betweenness via Random Approximation
+ */
+class KadabraBetweenness: public NetworKit::Centrality {
+
+public:
+
+	/**
+	 * The algorithm approximates the betweenness of all vertices so that the scores are within an additive
+	 * error @a epsilon with probability at least (1 - @a delta), or, if @a k is positive, so that additionally
+	 * the k nodes with highest betweenness are found. The values are normalized.
+	 *
+	 * Each sample is a shortest path between a random pair of nodes, found by a bidirectional BFS that always
+	 * expands the side with the smaller frontier. Unlike ApproxBetweenness, the number of samples is not fixed
+	 * up front: samples are taken in rounds, the threads accumulate the path nodes locally, and after each round
+	 * the counts are aggregated and sampling stops as soon as the confidence bounds of all nodes are tight enough.
+	 * The static bound of Riondato and Kornaropoulos is only used as the maximum number of samples. The result
+	 * does not depend on the number of threads.
+	 *
+	 * @param	G			the graph, unweighted
+	 * @param	epsilon		maximum additive error
+	 * @param	delta		probability that the values are not within the error guarantee
+	 * @param	k			if positive, sampling stops once the top-k nodes are certain or within the error
+	 */
+	KadabraBetweenness(const Graph& G, const double epsilon=0.01, const double delta=0.1, const count k=0);
+
+	void run() override;
+
+	/**
+	 * @return number of samples taken in last run
+	 */
+	count numberOfSamples() const;
+
+	/**
+	 * @return maximum number of samples, given by the static bound on the vertex diameter
+	 */
+	count maximumNumberOfSamples() const;
+
+private:
+
+	double epsilon;
+	double delta;
+	count k;
+	count tau; // number of samples taken in last run
+	count omega; // maximum number of samples
+
+	bool enoughSamples(const std::vector<count>& counts, double logInverseDelta) const;
+};
+
+} /* namespace NetworKit */
+
+#endif /* KADABRABETWEENNESS_H_ */
@@ -24,6 +24,7 @@ protected:
 	double alpha; // damping
 	double beta; // constant centrality amount
 	double tol; // error tolerance
+	bool singlePrecision;
 
 public:
 	/**
@@ -33,8 +34,9 @@ public:
 	 * @param[in] alpha Damping of the matrix vector product result
 	 * @param[in] beta Constant value added to the centrality of each vertex
 	 * @param[in] tol The tolerance for convergence.
+	 * @param[in] singlePrecision Iterate in single precision, see PowerIteration.
 	 */
-	KatzCentrality(const Graph& G, double alpha = 5e-4, double beta = 0.1, double tol = 1e-8);
+	KatzCentrality(const Graph& G, double alpha = 5e-4, double beta = 0.1, double tol = 1e-8, bool singlePrecision = false);
 
 	virtual void run();
 };
@@ -6,58 +6,41 @@
  */
 
 #include "PageRank.h"
+#include "PowerIteration.h"
 #include "../auxiliary/NumericTools.h"
-#include "../auxiliary/SignalHandling.h"
 
 namespace NetworKit {
 
-NetworKit::PageRank::PageRank(const Graph& G, double damp, double tol):
-		Centrality(G, true), damp(damp), tol(tol)
+NetworKit::PageRank::PageRank(const Graph& G, double damp, double tol, bool singlePrecision, bool gaussSeidel, bool extrapolate):
+		Centrality(G, true), damp(damp), tol(tol), singlePrecision(singlePrecision), gaussSeidel(gaussSeidel), extrapolate(extrapolate)
 {
 
 }
 
 void NetworKit::PageRank::run() {
-	Aux::SignalHandler handler;
 	count n = G.numberOfNodes();
 	count z = G.upperNodeIdBound();
 	double oneOverN = 1.0 / (double) n;
 	double teleportProb = (1.0 - damp) / (double) n;
-	scoreData.resize(z, oneOverN);
-	std::vector<double> pr = scoreData;
-	bool isConverged = false;
 
-	std::vector<double> deg(z, 0.0);
+	// every edge passes on the share w / deg of its source
+	std::vector<double> inverseDeg(z, 0.0);
 	G.parallelForNodes([&](node u) {
-		deg[u] = (double) G.weightedDegree(u);
+		double deg = G.weightedDegree(u);
+		inverseDeg[u] = deg != 0 ? 1.0 / deg : 0.0;
 	});
 
-	while (! isConverged) {
-		handler.assureRunning();
-		G.balancedParallelForNodes([&](node u) {
-			pr[u] = 0.0;
-			G.forInEdgesOf(u, [&](node u, node v, edgeweight w) {
-				// note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
-				// we follow the verbal description, which requires to sum over the incoming edges
-				pr[u] += scoreData[v] * w / deg[v];
-			});
-			pr[u] *= damp;
-			pr[u] += teleportProb;
-		});
+	// note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
+	// we follow the verbal description, which requires to sum over the incoming edges
+	PowerIteration iteration(G, damp, teleportProb, false, tol);
+	iteration.setSourceScale(inverseDeg);
+	iteration.setInitialValue(oneOverN);
+	iteration.setSinglePrecision(singlePrecision);
+	iteration.setGaussSeidel(gaussSeidel);
+	iteration.setExtrapolation(extrapolate ? 10 : 0);
+	iteration.run();
+	scoreData = iteration.getValues();
 
-		auto converged([&]() {
-			double diff = G.parallelSumForNodes([&](node u) {
-				double d = scoreData[u] - pr[u];
-				return d * d;
-			});
-//			TRACE("sqrt(diff): ", sqrt(diff));
-			return (sqrt(diff) <= tol);
-		});
-
-		isConverged = converged();
-		scoreData = pr;
-	}
-	handler.assureRunning();
 	// make sure scoreData sums up to 1
 	double sum = G.parallelSumForNodes([&](node u) {
 		return scoreData[u];
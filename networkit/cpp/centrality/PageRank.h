@@ -23,6 +23,9 @@ class PageRank: public NetworKit::Centrality {
 protected:
 	double damp;
 	double tol;
+	bool singlePrecision;
+	bool gaussSeidel;
+	bool extrapolate;
 
 public:
 	/**
@@ -31,8 +34,12 @@ public:
 	 * @param[in] G Graph to be processed.
 	 * @param[in] damp Damping factor of the PageRank algorithm.
 	 * @param[in] tol Error tolerance for PageRank iteration.
+	 * @param[in] singlePrecision Iterate in single precision.
+	 * @param[in] gaussSeidel Use Gauss-Seidel updates, which run sequentially but usually need fewer iterations.
+	 * @param[in] extrapolate Periodically extrapolate the iterates to speed up convergence.
+	 * See PowerIteration for details on the options.
 	 */
-	PageRank(const Graph& G, double damp=0.85, double tol = 1e-8);
+	PageRank(const Graph& G, double damp=0.85, double tol = 1e-8, bool singlePrecision = false, bool gaussSeidel = false, bool extrapolate = false);
 
 	virtual void run();
 
@@ -0,0 +1,230 @@
+/*
+ * ParallelTopCloseness.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "ParallelTopCloseness.h"
+#include "../components/ConnectedComponents.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <omp.h>
+
+namespace NetworKit {
+
+namespace {
+
+const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+
+/**
+ * Distances of one search. Only the entries of reached nodes are reset, so a cut off search costs
+ * only the part of the graph it has explored.
+ */
+struct SearchSpace {
+	std::vector<edgeweight> distance;
+	std::vector<node> reached;
+	std::vector<std::pair<edgeweight, node>> heap;
+
+	explicit SearchSpace(count z) : distance(z, infDist) {}
+};
+
+bool ranksHigher(const std::pair<double, node>& a, const std::pair<double, node>& b) {
+	return a.first > b.first || (a.first == b.first && a.second < b.second);
+}
+
+} /* anonymous namespace */
+
+ParallelTopCloseness::ParallelTopCloseness(const Graph& G, count k, bool harmonic) : Algorithm(), G(G), k(k), harmonic(harmonic), pruned(0) {
+	if (k == 0) {
+		throw std::runtime_error("k must be positive.");
+	}
+}
+
+void ParallelTopCloseness::run() {
+	const count z = G.upperNodeIdBound();
+	const count n = G.numberOfNodes();
+	const double norm = n > 1 ? n - 1.0 : 1.0;
+	const count threads = omp_get_max_threads();
+
+	// upper bound on the number of nodes reachable from each node, exact on undirected graphs
+	std::vector<count> reachable(z, n);
+	if (!G.isDirected()) {
+		ConnectedComponents cc(G);
+		cc.run();
+		std::map<index, count> sizes = cc.getComponentSizes();
+		G.forNodes([&](node v) {
+			reachable[v] = sizes[cc.componentOfNode(v)];
+		});
+	}
+
+	auto closeness = [&](double r, double farness) {
+		return r > 1 ? (r - 1) * (r - 1) / (norm * farness) : 0.0;
+	};
+
+	std::vector<SearchSpace> spaces(threads, SearchSpace(z));
+	// the score of the current k-th node, read without locking
+	std::atomic<double> threshold(0.0);
+
+	/*
+	 * Searches from s and returns the centrality of s, or a negative value if the search has been cut off.
+	 * When the first node at distance d is settled, all unsettled nodes have distance at least d.
+	 */
+	auto centralityOf = [&](node s, SearchSpace& space) -> double {
+		std::vector<edgeweight>& distance = space.distance;
+		std::vector<node>& reached = space.reached;
+		for (node v : reached) {
+			distance[v] = infDist;
+		}
+		reached.clear();
+		distance[s] = 0;
+		reached.push_back(s);
+
+		count settled = 0;
+		double farness = 0, inverseSum = 0;
+		edgeweight checked = 0;
+		bool cut = false;
+		auto settle = [&](node u) {
+			edgeweight d = distance[u];
+			if (d > checked) {
+				checked = d;
+				double remaining = reachable[s] - settled;
+				double bound;
+				if (harmonic) {
+					bound = (inverseSum + remaining / d) / norm;
+				} else if (!G.isDirected()) {
+					bound = closeness(reachable[s], farness + d * remaining);
+				} else {
+					// the bound is convex in the number r of reachable nodes, so it is largest for the smallest or largest r
+					double r = reached.size();
+					bound = std::max(closeness(r, farness + d * (r - settled)), closeness(n, farness + d * (n - settled)));
+				}
+				// the slack keeps rounding errors of weighted distances from cutting off ties
+				if (bound * (1 + 1e-9) < threshold.load(std::memory_order_relaxed)) {
+					cut = true;
+					return;
+				}
+			}
+			++settled;
+			farness += d;
+			if (d > 0) {
+				inverseSum += 1.0 / d;
+			}
+		};
+
+		if (!G.isWeighted()) {
+			// the reached nodes are in BFS order, so they double as the queue
+			for (index head = 0; head < reached.size(); ++head) {
+				node u = reached[head];
+				settle(u);
+				if (cut) {
+					break;
+				}
+				edgeweight next = distance[u] + 1;
+				G.forNeighborsOf(u, [&](node v) {
+					if (distance[v] == infDist) {
+						distance[v] = next;
+						reached.push_back(v);
+					}
+				});
+			}
+		} else {
+			auto& heap = space.heap;
+			auto later = std::greater<std::pair<edgeweight, node>>();
+			heap.assign(1, std::make_pair(0.0, s));
+			while (!heap.empty()) {
+				std::pop_heap(heap.begin(), heap.end(), later);
+				edgeweight d = heap.back().first;
+				node u = heap.back().second;
+				heap.pop_back();
+				if (d > distance[u]) {
+					continue;
+				}
+				settle(u);
+				if (cut) {
+					break;
+				}
+				G.forNeighborsOf(u, [&](node v, edgeweight w) {
+					if (d + w < distance[v]) {
+						if (distance[v] == infDist) {
+							reached.push_back(v);
+						}
+						distance[v] = d + w;
+						heap.push_back(std::make_pair(d + w, v));
+						std::push_heap(heap.begin(), heap.end(), later);
+					}
+				});
+			}
+		}
+		if (cut) {
+			return -1.0;
+		}
+		return harmonic ? inverseSum / norm : closeness(settled, farness);
+	};
+
+	// high degree nodes first, they tend to be central and raise the threshold early
+	std::vector<node> order = G.nodes();
+	std::stable_sort(order.begin(), order.end(), [&](node a, node b) {
+		return G.degree(a) > G.degree(b);
+	});
+
+	const count size = std::min(k, n);
+	// the best nodes found so far, the k-th one on top
+	std::vector<std::pair<double, node>> best;
+	best.reserve(size + 1);
+	count cutOff = 0;
+
+	#pragma omp parallel for schedule(dynamic, 1) reduction(+:cutOff)
+	for (index i = 0; i < order.size(); ++i) {
+		node s = order[i];
+		double score = centralityOf(s, spaces[omp_get_thread_num()]);
+		if (score < 0) {
+			++cutOff;
+			continue;
+		}
+		if (score < threshold.load(std::memory_order_relaxed)) {
+			continue;
+		}
+		#pragma omp critical
+		{
+			best.push_back(std::make_pair(score, s));
+			std::push_heap(best.begin(), best.end(), ranksHigher);
+			if (best.size() > size) {
+				std::pop_heap(best.begin(), best.end(), ranksHigher);
+				best.pop_back();
+			}
+			if (best.size() == size) {
+				threshold.store(best.front().first, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	std::sort_heap(best.begin(), best.end(), ranksHigher);
+	topk.clear();
+	topkScores.clear();
+	for (auto& entry : best) {
+		topk.push_back(entry.second);
+		topkScores.push_back(entry.first);
+	}
+	pruned = cutOff;
+	hasRun = true;
+}
+
+std::vector<node> ParallelTopCloseness::topkNodesList() const {
+	assureFinished();
+	return topk;
+}
+
+std::vector<double> ParallelTopCloseness::topkScoresList() const {
+	assureFinished();
+	return topkScores;
+}
+
+count ParallelTopCloseness::numberOfPrunedSearches() const {
+	assureFinished();
+	return pruned;
+}
+
+} /* namespace NetworKit */
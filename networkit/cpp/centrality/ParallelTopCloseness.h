@@ -0,0 +1,70 @@
+/*
+ * ParallelTopCloseness.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef PARALLELTOPCLOSENESS_H_
+#define PARALLELTOPCLOSENESS_H_
+
+#include "../graph/Graph.h"
+#include "../base/Algorithm.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ */
+class ParallelTopCloseness : public Algorithm {
+public:
+
+	/**
+	 * Finds the k nodes with highest closeness or harmonic centrality without computing the centrality of all nodes.
+	 * Every thread runs single-source searches from the nodes in order of decreasing degree. A search is cut off as
+	 * soon as an upper bound on the centrality of its source drops below the score of the current k-th node, which all
+	 * threads share and read without locking. The bounds follow "Computing Top-k Closeness Centrality Faster in Unweighted
+	 * Graphs", Bergamini et al., ALENEX16: once all nodes up to distance d are settled, every remaining node has distance
+	 * at least d. Unweighted graphs are searched by BFS, weighted graphs by Dijkstra, with one workspace per thread.
+	 *
+	 * The closeness of a node v that reaches r nodes, itself included, at total distance f is (r-1)^2 / ((n-1) f), as in
+	 * TopCloseness, which is the normalized closeness on connected graphs. The harmonic centrality of v is the sum of
+	 * 1 / d(v,w) over all nodes w != v reachable from v, divided by n-1. On directed graphs the distances from v are used.
+	 *
+	 * @param G The graph.
+	 * @param k Number of nodes with highest centrality that have to be found.
+	 * @param harmonic If true, harmonic centrality is used, otherwise closeness.
+	 */
+	ParallelTopCloseness(const Graph& G, count k = 1, bool harmonic = false);
+
+	/**
+	 * Computes the top-k nodes.
+	 */
+	void run() override;
+
+	/**
+	 * Returns a list with the k nodes with highest centrality, ties are broken by smaller id.
+	 */
+	std::vector<node> topkNodesList() const;
+
+	/**
+	 * Returns a list with the scores of the k nodes with highest centrality.
+	 */
+	std::vector<double> topkScoresList() const;
+
+	/**
+	 * Returns the number of searches that have been cut off.
+	 */
+	count numberOfPrunedSearches() const;
+
+private:
+	const Graph& G;
+	const count k;
+	const bool harmonic;
+	std::vector<node> topk;
+	std::vector<double> topkScores;
+	count pruned;
+};
+
+} /* namespace NetworKit */
+
+#endif /* PARALLELTOPCLOSENESS_H_ */
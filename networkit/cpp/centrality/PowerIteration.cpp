@@ -0,0 +1,227 @@
+/*
+ * PowerIteration.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "PowerIteration.h"
+#include "../auxiliary/SignalHandling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace NetworKit {
+
+namespace {
+
+/**
+ * The incoming edges of all nodes in compressed sparse row form.
+ */
+template<typename T>
+struct InEdges {
+	std::vector<index> offsets;
+	std::vector<node> sources;
+	std::vector<T> weights;
+
+	InEdges(const Graph& G, const std::vector<double>& sourceScale) : offsets(G.upperNodeIdBound() + 1, 0) {
+		const count z = G.upperNodeIdBound();
+		G.parallelForNodes([&](node u) {
+			count degree = 0;
+			G.forInEdgesOf(u, [&](node, node, edgeweight) {
+				++degree;
+			});
+			offsets[u + 1] = degree;
+		});
+		for (index u = 0; u < z; ++u) {
+			offsets[u + 1] += offsets[u];
+		}
+		sources.resize(offsets[z]);
+		weights.resize(offsets[z]);
+		G.parallelForNodes([&](node u) {
+			index e = offsets[u];
+			G.forInEdgesOf(u, [&](node, node v, edgeweight w) {
+				sources[e] = v;
+				weights[e] = sourceScale.empty() ? w : w * sourceScale[v];
+				++e;
+			});
+		});
+	}
+
+	T product(node u, const std::vector<T>& x) const {
+		T sum = 0;
+		for (index e = offsets[u]; e < offsets[u + 1]; ++e) {
+			sum += weights[e] * x[sources[e]];
+		}
+		return sum;
+	}
+};
+
+} /* anonymous namespace */
+
+PowerIteration::PowerIteration(const Graph& G, double factor, double offset, bool normalize, double tol) : Algorithm(), G(G), factor(factor), offset(offset), normalize(normalize), tol(tol), initialValue(1.0), singlePrecision(false), gaussSeidel(false), extrapolationInterval(0), iterations(0) {
+}
+
+void PowerIteration::setSourceScale(const std::vector<double>& scale) {
+	sourceScale = scale;
+}
+
+void PowerIteration::setInitialValue(double value) {
+	initialValue = value;
+}
+
+void PowerIteration::setSinglePrecision(bool singlePrecision) {
+	this->singlePrecision = singlePrecision;
+}
+
+void PowerIteration::setGaussSeidel(bool gaussSeidel) {
+	this->gaussSeidel = gaussSeidel;
+}
+
+void PowerIteration::setExtrapolation(count interval) {
+	if (interval > 0 && interval < 4) {
+		throw std::runtime_error("Extrapolation needs four iterates, the interval must be at least 4");
+	}
+	extrapolationInterval = interval;
+}
+
+void PowerIteration::run() {
+	if (normalize && (gaussSeidel || extrapolationInterval > 0)) {
+		throw std::runtime_error("Gauss-Seidel updates and extrapolation require an iteration without normalization");
+	}
+	if (gaussSeidel && extrapolationInterval > 0) {
+		throw std::runtime_error("Extrapolation requires simultaneous updates");
+	}
+	if (!sourceScale.empty() && sourceScale.size() < G.upperNodeIdBound()) {
+		throw std::runtime_error("The source scaling needs a value for every node");
+	}
+	if (singlePrecision) {
+		iterate<float>();
+	} else {
+		iterate<double>();
+	}
+	hasRun = true;
+}
+
+template<typename T>
+void PowerIteration::iterate() {
+	Aux::SignalHandler handler;
+	const count z = G.upperNodeIdBound();
+	const InEdges<T> in(G, sourceScale);
+	// below this relative change, rounding errors dominate
+	const double precision = 16 * std::numeric_limits<T>::epsilon();
+
+	std::vector<T> x(z, 0), next;
+	G.forNodes([&](node u) {
+		x[u] = initialValue;
+	});
+	if (!gaussSeidel) {
+		next.assign(z, 0);
+	}
+	// the three iterates before an extrapolation
+	std::vector<T> history[3];
+
+	// with normalization, x is the last iterate before normalization and scale its inverse norm
+	T scale = 1;
+	double oldLength = 0;
+	iterations = 0;
+	bool converged = false;
+	while (!converged) {
+		handler.assureRunning();
+		const T a = factor * scale;
+		const T b = offset;
+		double squares = 0, change = 0;
+		if (gaussSeidel) {
+			G.forNodes([&](node u) {
+				T value = a * in.product(u, x) + b;
+				double d = value - x[u];
+				x[u] = value;
+				squares += (double) value * value;
+				change += d * d;
+			});
+		} else {
+			#pragma omp parallel for schedule(guided) reduction(+:squares, change)
+			for (index u = 0; u < z; ++u) {
+				if (G.hasNode(u)) {
+					T value = a * in.product(u, x) + b;
+					double d = value - x[u];
+					next[u] = value;
+					squares += (double) value * value;
+					change += d * d;
+				}
+			}
+			x.swap(next);
+		}
+		++iterations;
+
+		double length = sqrt(squares);
+		if (normalize) {
+			converged = std::fabs(length - oldLength) <= std::max(tol, precision * length);
+			oldLength = length;
+			scale = length > 0 ? 1 / length : 1;
+		} else {
+			converged = sqrt(change) <= std::max(tol, precision * length);
+		}
+
+		if (extrapolationInterval > 0 && !converged) {
+			count phase = iterations % extrapolationInterval;
+			if (phase + 3 == extrapolationInterval) {
+				history[0] = x;
+			} else if (phase + 2 == extrapolationInterval) {
+				history[1] = x;
+			} else if (phase + 1 == extrapolationInterval) {
+				history[2] = x;
+			} else if (phase == 0 && !history[0].empty()) {
+				// quadratic extrapolation (Kamvar et al., WWW 2003): removes the components of the two
+				// eigenvectors that dominate the error, estimated by least squares from the last four iterates
+				double y11 = 0, y12 = 0, y22 = 0, y13 = 0, y23 = 0;
+				#pragma omp parallel for reduction(+:y11, y12, y22, y13, y23)
+				for (index u = 0; u < z; ++u) {
+					double y1 = (double) history[1][u] - history[0][u];
+					double y2 = (double) history[2][u] - history[0][u];
+					double y3 = (double) x[u] - history[0][u];
+					y11 += y1 * y1;
+					y12 += y1 * y2;
+					y22 += y2 * y2;
+					y13 += y1 * y3;
+					y23 += y2 * y3;
+				}
+				double determinant = y11 * y22 - y12 * y12;
+				if (determinant > precision * y11 * y22) {
+					double gamma1 = (-y13 * y22 + y23 * y12) / determinant;
+					double gamma2 = (-y23 * y11 + y13 * y12) / determinant;
+					double beta0 = gamma1 + gamma2 + 1;
+					double beta1 = gamma2 + 1;
+					// the iteration is affine, so the combination has to be scaled to weights summing to 1
+					double sum = beta0 + beta1 + 1;
+					if (std::fabs(sum) > precision) {
+						const T w0 = beta0 / sum;
+						const T w1 = beta1 / sum;
+						const T w2 = 1 / sum;
+						#pragma omp parallel for
+						for (index u = 0; u < z; ++u) {
+							x[u] = w0 * history[1][u] + w1 * history[2][u] + w2 * x[u];
+						}
+					}
+				}
+			}
+		}
+	}
+
+	values.assign(z, 0);
+	G.parallelForNodes([&](node u) {
+		values[u] = normalize ? x[u] * (double) scale : x[u];
+	});
+}
+
+std::vector<double> PowerIteration::getValues() const {
+	assureFinished();
+	return values;
+}
+
+count PowerIteration::numberOfIterations() const {
+	assureFinished();
+	return iterations;
+}
+
+} /* namespace NetworKit */
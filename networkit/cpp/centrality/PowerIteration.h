@@ -0,0 +1,108 @@
+/*
+ * PowerIteration.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef POWERITERATION_H_
+#define POWERITERATION_H_
+
+#include "../graph/Graph.h"
+#include "../base/Algorithm.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Iterative solver shared by the spectral centralities. Starting from a constant vector x, it iterates
+ *
+ *     x'(u) = factor * sum over the incoming edges {v,u} of w(v,u) * s(v) * x(v) + offset,
+ *
+ * where s is an optional scaling of the sources (1 by default), until the iteration converges.
+ * If the iterates are normalized in 2-norm, the iteration has converged once the norm changes by
+ * at most the tolerance from one iteration to the next, otherwise once the 2-norm of the change of
+ * the iterate is at most the tolerance.
+ *
+ * The incoming edges are stored once in compressed sparse row form, with the source scaling folded
+ * into the weights, and every iteration is a single parallel pass over them that also computes the
+ * norm and the residual. Normalization is deferred to the next pass. The iterates and weights can be
+ * stored in single precision, which halves the memory traffic; the tolerance is then raised to what
+ * single precision can reach.
+ *
+ * Iterations without normalization, which solve a linear system, can additionally use Gauss-Seidel
+ * updates, which use the new values of nodes as soon as they are computed and usually need fewer
+ * iterations but run sequentially, and quadratic extrapolation (Kamvar et al., WWW 2003), which
+ * estimates the two eigenvectors that dominate the error from four successive iterates and removes them.
+ */
+class PowerIteration : public Algorithm {
+public:
+
+	/**
+	 * @param G The graph.
+	 * @param factor Factor of the matrix vector product.
+	 * @param offset Constant value added to each value.
+	 * @param normalize If true, the iterates are normalized in 2-norm.
+	 * @param tol The tolerance for convergence.
+	 */
+	PowerIteration(const Graph& G, double factor, double offset, bool normalize, double tol);
+
+	/**
+	 * Sets the scaling s(v) of the sources, indexed by node.
+	 */
+	void setSourceScale(const std::vector<double>& scale);
+
+	/**
+	 * Sets the value of all nodes in the first iterate, 1 by default.
+	 */
+	void setInitialValue(double value);
+
+	/**
+	 * Stores the iterates and weights in single instead of double precision.
+	 */
+	void setSinglePrecision(bool singlePrecision);
+
+	/**
+	 * Updates the values in place in node order. Requires an iteration without normalization.
+	 */
+	void setGaussSeidel(bool gaussSeidel);
+
+	/**
+	 * Extrapolates the values every @a interval >= 4 iterations, 0 disables extrapolation. Requires an
+	 * iteration without normalization and without Gauss-Seidel updates.
+	 */
+	void setExtrapolation(count interval);
+
+	void run() override;
+
+	/**
+	 * @return The values of the last iterate, normalized if requested, indexed by node.
+	 */
+	std::vector<double> getValues() const;
+
+	/**
+	 * @return The number of iterations until convergence.
+	 */
+	count numberOfIterations() const;
+
+private:
+	const Graph& G;
+	const double factor;
+	const double offset;
+	const bool normalize;
+	const double tol;
+	std::vector<double> sourceScale;
+	double initialValue;
+	bool singlePrecision;
+	bool gaussSeidel;
+	count extrapolationInterval;
+
+	std::vector<double> values;
+	count iterations;
+
+	template<typename T>
+	void iterate();
+};
+
+} /* namespace NetworKit */
+
+#endif /* POWERITERATION_H_ */
@@ -11,6 +11,7 @@
 #include "../auxiliary/Timer.h"
 #include "../spanning/RandomSpanningTree.h"
 #include "../spanning/PseudoRandomSpanningTree.h"
+#include "../distance/EffectiveResistanceSketch.h"
 
 #include <fstream>
 #include <sstream>
@@ -106,43 +107,10 @@ void SpanningEdgeCentrality::runApproximation() {
 }
 
 void SpanningEdgeCentrality::runParallelApproximation() {
-	const count n = G.numberOfNodes();
-	const count m = G.numberOfEdges();
-	double epsilon2 = tol * tol;
-	const count k = ceil(log2(n)) / epsilon2;
-	double randTab[3] = {1/sqrt(k), -1/sqrt(k)};
-	std::vector<Vector> solutions(k, Vector(n));
-	std::vector<Vector> rhs(k, Vector(n));
-	scoreData.clear();
-	scoreData.resize(m, 0.0);
-
-#pragma omp parallel for
-	for (index i = 0; i < k; ++i) {
-		// rhs(v) = \sum_e=1 ^m q(e) * B(e, v)
-		//        = +/- q(e)
-		G.forEdges([&](node u, node v) {
-			double r = randTab[Aux::Random::integer(1)];
-
-			if (u < v) {
-				rhs[i][u] += r;
-				rhs[i][v] -= r;
-			}
-			else {
-				rhs[i][u] -= r;
-				rhs[i][v] += r;
-			}
-		});
-	}
-
-	lamg.parallelSolve(rhs, solutions);
-
-	for (index i = 0; i < k; ++i) {
-		G.parallelForEdges([&](node u, node v, edgeid e) {
-			double diff = solutions[i][u] - solutions[i][v];
-			scoreData[e] += diff * diff; // TODO: fix weighted case!
-		});
-	}
-
+	// one sketch over the shared hierarchy: projections solved in parallel blocks, edge scores read off afterwards
+	EffectiveResistanceSketch sketch(G, lamg, tol);
+	sketch.run();
+	scoreData = sketch.edgeScores();
 	hasRun = true;
 }
 
@@ -11,11 +11,13 @@
 #include "../DynApproxBetweenness.h"
 #include "../ApproxBetweenness.h"
 #include "../ApproxBetweenness2.h"
+#include "../KadabraBetweenness.h"
 #include "../SpanningEdgeCentrality.h"
 #include "../ApproxCloseness.h"
 #include "../EigenvectorCentrality.h"
 #include "../KatzCentrality.h"
 #include "../PageRank.h"
+#include "../PowerIteration.h"
 #include "../KPathCentrality.h"
 #include "../CoreDecomposition.h"
 #include "../LocalClusteringCoefficient.h"
@@ -30,8 +32,12 @@
 #include "../../generators/ErdosRenyiGenerator.h"
 #include "../../generators/DorogovtsevMendesGenerator.h"
 #include "../TopCloseness.h"
+#include "../ParallelTopCloseness.h"
+#include "../../graph/Dijkstra.h"
+#include "../../auxiliary/Random.h"
 #include <iostream>
 #include <iomanip>
+#include <omp.h>
 
 
 
@@ -128,6 +134,81 @@ TEST_F(CentralityGTest, testApproxBetweennessSmallGraph) {
 	DEBUG("scores: ", bc);
 }
 
+TEST_F(CentralityGTest, testApproxBetweennessReproducible) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(200, 0.05).generate();
+	int maxThreads = omp_get_max_threads();
+
+	Aux::Random::setSeed(1, false);
+	omp_set_num_threads(1);
+	ApproxBetweenness sequential(G, 0.1, 0.1);
+	sequential.run();
+
+	Aux::Random::setSeed(1, false);
+	omp_set_num_threads(4);
+	ApproxBetweenness parallel(G, 0.1, 0.1);
+	parallel.run();
+	omp_set_num_threads(maxThreads);
+
+	EXPECT_EQ(sequential.scores(), parallel.scores());
+}
+
+
+TEST_F(CentralityGTest, testKadabraBetweenness) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(200, 0.03).generate();
+	double epsilon = 0.02;
+	Betweenness exact(G, true);
+	exact.run();
+	// the normalized exact scores of undirected graphs count every pair twice
+	auto expected = [&](node v) {
+		return exact.score(v) / 2;
+	};
+
+	Aux::Random::setSeed(1, false);
+	KadabraBetweenness kadabra(G, epsilon, 0.1);
+	kadabra.run();
+	EXPECT_LE(kadabra.numberOfSamples(), kadabra.maximumNumberOfSamples());
+	G.forNodes([&](node v) {
+		EXPECT_NEAR(expected(v), kadabra.score(v), epsilon);
+	});
+
+	// with the same samples, finding the top nodes never takes longer
+	Aux::Random::setSeed(1, false);
+	KadabraBetweenness top(G, epsilon, 0.1, 5);
+	top.run();
+	EXPECT_LE(top.numberOfSamples(), kadabra.numberOfSamples());
+	G.forNodes([&](node v) {
+		EXPECT_NEAR(expected(v), top.score(v), epsilon);
+	});
+
+	// the result does not depend on the number of threads
+	int maxThreads = omp_get_max_threads();
+	Aux::Random::setSeed(1, false);
+	omp_set_num_threads(1);
+	KadabraBetweenness sequential(G, epsilon, 0.1);
+	sequential.run();
+	Aux::Random::setSeed(1, false);
+	omp_set_num_threads(4);
+	KadabraBetweenness parallel(G, epsilon, 0.1);
+	parallel.run();
+	omp_set_num_threads(maxThreads);
+	EXPECT_EQ(sequential.numberOfSamples(), parallel.numberOfSamples());
+	EXPECT_EQ(sequential.scores(), parallel.scores());
+
+	Graph D = ErdosRenyiGenerator(200, 0.03, true).generate();
+	Betweenness exactDirected(D, true);
+	exactDirected.run();
+	KadabraBetweenness directed(D, epsilon, 0.1);
+	directed.run();
+	D.forNodes([&](node v) {
+		EXPECT_NEAR(exactDirected.score(v), directed.score(v), epsilon);
+	});
+
+	Graph weighted(3, true);
+	EXPECT_THROW(KadabraBetweenness kadabraWeighted(weighted), std::runtime_error);
+}
+
 
 TEST_F(CentralityGTest, testBetweennessCentralityWeighted) {
  /* Graph:
@@ -280,6 +361,75 @@ TEST_F(CentralityGTest, testPageRankCentrality) {
 	EXPECT_NEAR(0.2552, fabs(cen[5]), tol);
 	EXPECT_NEAR(0.0753, fabs(cen[6]), tol);
 	EXPECT_NEAR(0.0565, fabs(cen[7]), tol);
+
+	EXPECT_EQ(cen, centrality.scoresView());
+}
+
+TEST_F(CentralityGTest, testPowerIterationVariants) {
+	SNAPGraphReader reader;
+	Graph G = reader.read("input/wiki-Vote.txt");
+	std::vector<node> top = {699, 0, 1, 10};
+
+	PageRank reference(G);
+	reference.run();
+	for (bool singlePrecision : {false, true}) {
+		for (bool gaussSeidel : {false, true}) {
+			for (bool extrapolate : {false, true}) {
+				if (gaussSeidel && extrapolate) {
+					continue;
+				}
+				PageRank pr(G, 0.85, 1e-8, singlePrecision, gaussSeidel, extrapolate);
+				pr.run();
+				// the iterations stop within (tol / (1 - damp)) of the solution
+				double tol = singlePrecision ? 1e-6 : 1e-7;
+				G.forNodes([&](node u) {
+					EXPECT_NEAR(reference.score(u), pr.score(u), tol);
+				});
+			}
+		}
+	}
+
+	KatzCentrality katz(G);
+	katz.run();
+	KatzCentrality katzSingle(G, 5e-4, 0.1, 1e-8, true);
+	katzSingle.run();
+	EigenvectorCentrality ev(G);
+	ev.run();
+	EigenvectorCentrality evSingle(G, 1e-8, true);
+	evSingle.run();
+	for (node u : top) {
+		EXPECT_NEAR(katz.score(u), katzSingle.score(u), 1e-5);
+		EXPECT_NEAR(ev.score(u), evSingle.score(u), 1e-3);
+	}
+
+	// Gauss-Seidel updates need fewer iterations for the same linear system
+	std::vector<double> inverseDegree(G.upperNodeIdBound());
+	G.forNodes([&](node u) {
+		inverseDegree[u] = G.degree(u) > 0 ? 1.0 / G.degree(u) : 0.0;
+	});
+	PowerIteration jacobi(G, 0.85, 0.15 / G.numberOfNodes(), false, 1e-10);
+	jacobi.setSourceScale(inverseDegree);
+	jacobi.run();
+	PowerIteration gaussSeidel(G, 0.85, 0.15 / G.numberOfNodes(), false, 1e-10);
+	gaussSeidel.setSourceScale(inverseDegree);
+	gaussSeidel.setGaussSeidel(true);
+	gaussSeidel.run();
+	EXPECT_LT(gaussSeidel.numberOfIterations(), jacobi.numberOfIterations());
+
+	// and so does extrapolation, with the same result
+	PowerIteration extrapolated(G, 0.85, 0.15 / G.numberOfNodes(), false, 1e-10);
+	extrapolated.setSourceScale(inverseDegree);
+	extrapolated.setExtrapolation(10);
+	extrapolated.run();
+	EXPECT_LT(extrapolated.numberOfIterations(), jacobi.numberOfIterations());
+	std::vector<double> exact = jacobi.getValues(), approximate = extrapolated.getValues();
+	G.forNodes([&](node u) {
+		EXPECT_NEAR(exact[u], approximate[u], 1e-8);
+	});
+
+	PowerIteration normalized(G, 1.0, 0.0, true, 1e-8);
+	normalized.setGaussSeidel(true);
+	EXPECT_THROW(normalized.run(), std::runtime_error);
 }
 
 TEST_F(CentralityGTest, benchSequentialBetweennessCentralityOnRealGraph) {
@@ -902,4 +1052,88 @@ TEST_F(CentralityGTest, testTopClosenessUndirected) {
     }
 }
 
+namespace {
+
+/**
+ * Checks the top-k of ParallelTopCloseness against the centralities of all nodes computed by Dijkstra.
+ */
+void expectTopCloseness(const Graph& G, count k, bool harmonic) {
+	count n = G.numberOfNodes();
+	std::vector<std::pair<double, node>> expected;
+	G.forNodes([&](node u) {
+		Dijkstra dijkstra(G, u, false);
+		dijkstra.run();
+		double farness = 0, inverseSum = 0;
+		count reached = 0;
+		for (edgeweight d : dijkstra.getDistances()) {
+			if (d != std::numeric_limits<edgeweight>::max()) {
+				++reached;
+				farness += d;
+				inverseSum += d > 0 ? 1.0 / d : 0.0;
+			}
+		}
+		double closeness = reached > 1 ? (reached - 1.0) * (reached - 1.0) / ((n - 1.0) * farness) : 0.0;
+		expected.push_back(std::make_pair(harmonic ? inverseSum / (n - 1.0) : closeness, u));
+	});
+	std::sort(expected.begin(), expected.end(), [](const std::pair<double, node>& a, const std::pair<double, node>& b) {
+		return a.first > b.first;
+	});
+
+	ParallelTopCloseness top(G, k, harmonic);
+	top.run();
+	std::vector<node> nodes = top.topkNodesList();
+	std::vector<double> scores = top.topkScoresList();
+	ASSERT_EQ(std::min(k, n), nodes.size());
+	for (index i = 0; i < nodes.size(); ++i) {
+		EXPECT_NEAR(expected[i].first, scores[i], 1e-9);
+		auto entry = std::find_if(expected.begin(), expected.end(), [&](const std::pair<double, node>& e) {
+			return e.second == nodes[i];
+		});
+		EXPECT_NEAR(entry->first, scores[i], 1e-9);
+	}
+}
+
+} /* anonymous namespace */
+
+TEST_F(CentralityGTest, testParallelTopCloseness) {
+	Aux::Random::setSeed(42, false);
+	Graph G = DorogovtsevMendesGenerator(400).generate();
+	Closeness cc(G, true);
+	cc.run();
+	ParallelTopCloseness top(G, 10);
+	top.run();
+	for (index i = 0; i < 10; i++) {
+		EXPECT_NEAR(cc.ranking()[i].second, top.topkScoresList()[i], 1e-9);
+	}
+	EXPECT_GT(top.numberOfPrunedSearches(), 0u);
+
+	for (bool harmonic : {false, true}) {
+		expectTopCloseness(G, 10, harmonic);
+
+		// disconnected, weighted and directed graphs
+		Graph E = ErdosRenyiGenerator(300, 0.008).generate();
+		expectTopCloseness(E, 20, harmonic);
+		Graph W(E, true, false);
+		W.forEdges([&](node u, node v) {
+			W.setWeight(u, v, Aux::Random::real(0.5, 3.0));
+		});
+		expectTopCloseness(W, 20, harmonic);
+		Graph D(300, false, true);
+		for (index i = 0; i < 600; ++i) {
+			node u = Aux::Random::integer(299);
+			node v = Aux::Random::integer(299);
+			if (u != v && !D.hasEdge(u, v)) {
+				D.addEdge(u, v);
+			}
+		}
+		expectTopCloseness(D, 20, harmonic);
+		expectTopCloseness(Graph(D, true, true), 20, harmonic);
+
+		Graph small(5);
+		small.addEdge(0, 1);
+		expectTopCloseness(small, 10, harmonic);
+	}
+	EXPECT_THROW(ParallelTopCloseness(G, 0), std::runtime_error);
+}
+
 } /* namespace NetworKit */
@@ -0,0 +1,81 @@
+/*
+ * LabelWeights.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef LABELWEIGHTS_H_
+#define LABELWEIGHTS_H_
+
+#include "../Globals.h"
+
+#include <vector>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Sums edge weights per label in the neighborhood of a single node, as needed by label propagation.
+ * The open-addressing table is only cleared at the touched slots, so one instance per thread is
+ * reused for all nodes and its size is bounded by twice the maximum degree.
+ */
+class LabelWeights {
+public:
+	/**
+	 * Prepares the table for a node of degree @a degree. Has to be called before the first add().
+	 */
+	void reset(count degree) {
+		count capacity = 8;
+		unsigned bits = 3;
+		while (capacity < 2 * degree) {
+			capacity <<= 1;
+			++bits;
+		}
+		if (keys.size() < capacity) {
+			keys.assign(capacity, none);
+			weights.assign(capacity, 0.0);
+		}
+		shift = 64 - bits;
+		mask = capacity - 1;
+	}
+
+	/**
+	 * Adds @a w to the weight of label @a l.
+	 */
+	void add(index l, double w) {
+		index slot = (l * 0x9E3779B97F4A7C15ULL) >> shift;
+		while (keys[slot] != l) {
+			if (keys[slot] == none) {
+				keys[slot] = l;
+				touched.push_back(slot);
+				break;
+			}
+			slot = (slot + 1) & mask;
+		}
+		weights[slot] += w;
+	}
+
+	/**
+	 * Calls @a handle(label, weight) for every label added since the last reset and clears the table.
+	 */
+	template<typename L>
+	void consume(L handle) {
+		for (index slot : touched) {
+			handle(keys[slot], weights[slot]);
+			keys[slot] = none;
+			weights[slot] = 0.0;
+		}
+		touched.clear();
+	}
+
+private:
+	std::vector<index> keys;
+	std::vector<double> weights;
+	std::vector<index> touched;
+	unsigned shift = 61;
+	index mask = 7;
+};
+
+} /* namespace NetworKit */
+
+#endif /* LABELWEIGHTS_H_ */
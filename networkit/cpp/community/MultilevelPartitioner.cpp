@@ -0,0 +1,307 @@
+/*
+ * MultilevelPartitioner.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "MultilevelPartitioner.h"
+#include "LabelWeights.h"
+#include "../coarsening/ParallelPartitionCoarsening.h"
+#include "../auxiliary/Log.h"
+#include "../auxiliary/Random.h"
+
+#include <omp.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <sstream>
+
+namespace NetworKit {
+
+namespace {
+
+const count coarseningIterations = 3;
+const count refinementIterations = 10;
+const count clusterFactor = 16; // clusters of the coarsening weigh at most 1/clusterFactor of a block
+const count initialPartitioningAttempts = 8;
+
+/**
+ * Size-constrained label propagation: every node moves to the label it is most strongly connected to,
+ * unless the label would become heavier than @a maxWeight. Ties are broken in favor of the current and
+ * then of the lighter label, so the cut does not increase. If @a rebalance is set, nodes of labels that
+ * are heavier than @a maxWeight also move if this increases the cut.
+ *
+ * @return The number of moves.
+ */
+count propagate(const Graph& G, const std::vector<count>& nodeWeight, std::vector<index>& labels, std::vector<count>& labelWeight, count maxWeight, count iterations, bool rebalance) {
+	const int numThreads = omp_get_max_threads();
+	std::vector<LabelWeights> threadWeights(numThreads);
+	const count z = G.upperNodeIdBound();
+	count moved = 0;
+
+	for (index iteration = 0; iteration < iterations; ++iteration) {
+		count nMoved = 0;
+		#pragma omp parallel num_threads(numThreads) reduction(+:nMoved)
+		{
+			LabelWeights& weights = threadWeights[omp_get_thread_num()];
+
+			#pragma omp for schedule(guided)
+			for (node v = 0; v < z; ++v) {
+				if (!G.hasNode(v) || G.degree(v) == 0) {
+					continue;
+				}
+				const index current = labels[v];
+				const count w = nodeWeight[v];
+				count currentWeight;
+				#pragma omp atomic read
+				currentWeight = labelWeight[current];
+				const bool overloaded = rebalance && currentWeight > maxWeight;
+
+				weights.reset(G.degree(v) + 1);
+				weights.add(current, 0.0);
+				G.forNeighborsOf(v, [&](node u, edgeweight ew) {
+					if (u != v) {
+						weights.add(labels[u], ew);
+					}
+				});
+
+				index best = none;
+				double bestConnection = -std::numeric_limits<double>::infinity();
+				count bestWeight = 0;
+				weights.consume([&](index l, double connection) {
+					count weight;
+					#pragma omp atomic read
+					weight = labelWeight[l];
+					if (l == current ? overloaded : weight + w > maxWeight) {
+						return;
+					}
+					if (connection > bestConnection || (connection == bestConnection && best != current && (l == current || weight < bestWeight))) {
+						best = l;
+						bestConnection = connection;
+						bestWeight = weight;
+					}
+				});
+
+				if (best == none || best == current) {
+					continue;
+				}
+
+				// another thread may have filled the label in the meantime
+				count newWeight;
+				#pragma omp atomic capture
+				newWeight = labelWeight[best] += w;
+				if (newWeight > maxWeight) {
+					#pragma omp atomic update
+					labelWeight[best] -= w;
+					continue;
+				}
+				#pragma omp atomic update
+				labelWeight[current] -= w;
+				labels[v] = best;
+				nMoved += 1;
+			}
+		}
+		moved += nMoved;
+		if (nMoved == 0) {
+			break;
+		}
+	}
+	return moved;
+}
+
+/**
+ * Greedy graph growing: blocks 0, ..., k-2 are grown by breadth-first search from random nodes until they
+ * reach their share of the total weight, block k-1 gets the remaining nodes.
+ */
+std::vector<index> growBlocks(const Graph& G, const std::vector<count>& nodeWeight, count k, count totalWeight, Aux::Random::SplitMix64& urng) {
+	std::vector<index> part(G.upperNodeIdBound(), none);
+	std::vector<node> order = G.nodes();
+	std::shuffle(order.begin(), order.end(), urng);
+	const count target = (totalWeight + k - 1) / k;
+
+	index next = 0;
+	for (index b = 0; b + 1 < k; ++b) {
+		count weight = 0;
+		std::queue<node> queue;
+		auto take = [&](node v) {
+			part[v] = b;
+			weight += nodeWeight[v];
+			queue.push(v);
+		};
+		while (weight < target) {
+			if (queue.empty()) {
+				// the component is exhausted, continue at a random unassigned node
+				while (next < order.size() && part[order[next]] != none) {
+					++next;
+				}
+				if (next == order.size()) {
+					break;
+				}
+				take(order[next]);
+				continue;
+			}
+			node v = queue.front();
+			queue.pop();
+			G.forNeighborsOf(v, [&](node u) {
+				if (part[u] == none && weight < target) {
+					take(u);
+				}
+			});
+		}
+	}
+	G.forNodes([&](node v) {
+		if (part[v] == none) {
+			part[v] = k - 1;
+		}
+	});
+	return part;
+}
+
+std::vector<count> blockWeights(const Graph& G, const std::vector<count>& nodeWeight, const std::vector<index>& part, count k) {
+	std::vector<count> weights(k, 0);
+	G.forNodes([&](node v) {
+		weights[part[v]] += nodeWeight[v];
+	});
+	return weights;
+}
+
+double cutWeight(const Graph& G, const std::vector<index>& part) {
+	double cut = 0.0;
+	G.forEdges([&](node u, node v, edgeweight w) {
+		if (part[u] != part[v]) {
+			cut += w;
+		}
+	});
+	return cut;
+}
+
+} /* anonymous namespace */
+
+MultilevelPartitioner::MultilevelPartitioner(const Graph& G, count k, double epsilon) : CommunityDetectionAlgorithm(G), k(k), epsilon(epsilon), levels(0) {
+	if (k == 0) {
+		throw std::runtime_error("The number of blocks must be positive.");
+	}
+	if (epsilon < 0.0) {
+		throw std::runtime_error("The imbalance must not be negative.");
+	}
+	if (G.isDirected()) {
+		throw std::runtime_error("The graph must be undirected.");
+	}
+}
+
+void MultilevelPartitioner::run() {
+	const count totalWeight = G.numberOfNodes();
+	const count maxBlockWeight = (count) std::floor((1.0 + epsilon) * ((totalWeight + k - 1) / k));
+	const count maxClusterWeight = std::max((count) 1, maxBlockWeight / clusterFactor);
+	const count contractionLimit = 2 * clusterFactor * k;
+
+	// level i > 0 is coarse[i-1], maps[i-1] maps the nodes of level i-1 to those of level i
+	std::vector<Graph> coarse;
+	std::vector<std::vector<node>> maps;
+	std::vector<std::vector<count>> nodeWeights(1, std::vector<count>(G.upperNodeIdBound(), 0));
+	G.forNodes([&](node v) {
+		nodeWeights[0][v] = 1;
+	});
+	auto graphAt = [&](index level) -> const Graph& {
+		return level == 0 ? G : coarse[level - 1];
+	};
+
+	// coarsening
+	while (graphAt(coarse.size()).numberOfNodes() > contractionLimit) {
+		const Graph& Gfine = graphAt(coarse.size());
+		std::vector<index> labels(Gfine.upperNodeIdBound(), none);
+		Gfine.forNodes([&](node v) {
+			labels[v] = v;
+		});
+		std::vector<count> clusterWeights = nodeWeights.back();
+		propagate(Gfine, nodeWeights.back(), labels, clusterWeights, maxClusterWeight, coarseningIterations, false);
+
+		Partition zeta(labels);
+		zeta.setUpperBound(Gfine.upperNodeIdBound());
+		ParallelPartitionCoarsening coarsening(Gfine, zeta);
+		coarsening.run();
+		Graph Gcoarse = coarsening.getCoarseGraph();
+		if (Gcoarse.numberOfNodes() > 0.95 * Gfine.numberOfNodes()) {
+			break; // no progress anymore
+		}
+
+		std::vector<node> map = coarsening.getFineToCoarseNodeMapping();
+		std::vector<count> weights(Gcoarse.upperNodeIdBound(), 0);
+		Gfine.forNodes([&](node v) {
+			weights[map[v]] += nodeWeights.back()[v];
+		});
+		DEBUG("MultilevelPartitioner: coarsened ", Gfine.numberOfNodes(), " to ", Gcoarse.numberOfNodes(), " nodes");
+		coarse.push_back(std::move(Gcoarse));
+		maps.push_back(std::move(map));
+		nodeWeights.push_back(std::move(weights));
+	}
+	levels = coarse.size() + 1;
+
+	// initial partitioning
+	const Graph& Gcoarsest = graphAt(coarse.size());
+	std::vector<std::vector<index>> attempts(initialPartitioningAttempts);
+	std::vector<count> overloads(initialPartitioningAttempts);
+	std::vector<double> cuts(initialPartitioningAttempts);
+	uint64_t seed = Aux::Random::integer();
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index a = 0; a < initialPartitioningAttempts; ++a) {
+		Aux::Random::SplitMix64 urng(seed, a);
+		attempts[a] = growBlocks(Gcoarsest, nodeWeights.back(), k, totalWeight, urng);
+		std::vector<count> weights = blockWeights(Gcoarsest, nodeWeights.back(), attempts[a], k);
+		propagate(Gcoarsest, nodeWeights.back(), attempts[a], weights, maxBlockWeight, refinementIterations, true);
+		overloads[a] = 0;
+		for (count weight : weights) {
+			overloads[a] += weight > maxBlockWeight ? weight - maxBlockWeight : 0;
+		}
+		cuts[a] = cutWeight(Gcoarsest, attempts[a]);
+	}
+	index best = 0;
+	for (index a = 1; a < initialPartitioningAttempts; ++a) {
+		if (std::make_pair(overloads[a], cuts[a]) < std::make_pair(overloads[best], cuts[best])) {
+			best = a;
+		}
+	}
+	std::vector<index> part = std::move(attempts[best]);
+
+	// uncoarsening and refinement
+	for (index level = coarse.size(); level > 0; --level) {
+		const Graph& Gfine = graphAt(level - 1);
+		const std::vector<node>& map = maps[level - 1];
+		std::vector<index> finePart(Gfine.upperNodeIdBound(), none);
+		Gfine.parallelForNodes([&](node v) {
+			finePart[v] = part[map[v]];
+		});
+		part.swap(finePart);
+		std::vector<count> weights = blockWeights(Gfine, nodeWeights[level - 1], part, k);
+		propagate(Gfine, nodeWeights[level - 1], part, weights, maxBlockWeight, refinementIterations, true);
+	}
+
+	// nodes without a neighbor in a block with space left are moved last
+	std::vector<count> weights = blockWeights(G, nodeWeights[0], part, k);
+	G.forNodes([&](node v) {
+		if (weights[part[v]] > maxBlockWeight) {
+			index lightest = std::min_element(weights.begin(), weights.end()) - weights.begin();
+			--weights[part[v]];
+			++weights[lightest];
+			part[v] = lightest;
+		}
+	});
+
+	result = part.empty() ? Partition() : Partition(part);
+	result.setUpperBound(k);
+	hasRun = true;
+}
+
+count MultilevelPartitioner::numberOfLevels() const {
+	assureFinished();
+	return levels;
+}
+
+std::string MultilevelPartitioner::toString() const {
+	std::stringstream stream;
+	stream << "MultilevelPartitioner(k=" << k << ", epsilon=" << epsilon << ")";
+	return stream.str();
+}
+
+} /* namespace NetworKit */
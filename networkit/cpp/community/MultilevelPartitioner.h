@@ -0,0 +1,59 @@
+/*
+ * MultilevelPartitioner.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef MULTILEVELPARTITIONER_H_
+#define MULTILEVELPARTITIONER_H_
+
+#include "CommunityDetectionAlgorithm.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Multilevel balanced k-way graph partitioner in the spirit of size-constrained label propagation
+ * partitioning (Meyerhenke, Sanders, Schulz: "Parallel Graph Partitioning for Complex Networks").
+ *
+ * The graph is coarsened by label propagation whose clusters are capped in weight and contracted with
+ * ParallelPartitionCoarsening until it is small. The coarsest graph is partitioned by several greedy
+ * graph growing attempts, and the best one is projected back level by level, where parallel label
+ * propagation over the k blocks moves boundary nodes to reduce the cut. A move is only made if the
+ * target block does not exceed (1 + epsilon) * ceil(n / k) nodes; blocks that are overloaded on coarse
+ * levels are rebalanced during refinement, so the final partition always satisfies the constraint.
+ */
+class MultilevelPartitioner : public CommunityDetectionAlgorithm {
+public:
+	/**
+	 * @param G The graph, edge weights are taken into account.
+	 * @param k The number of blocks.
+	 * @param epsilon The allowed imbalance.
+	 */
+	MultilevelPartitioner(const Graph& G, count k, double epsilon = 0.03);
+
+	/**
+	 * Computes the partition into the blocks 0, ..., k-1.
+	 */
+	virtual void run() override;
+
+	/**
+	 * @return The number of levels of the multilevel hierarchy of the last run, including the input graph.
+	 */
+	count numberOfLevels() const;
+
+	virtual std::string toString() const override;
+
+	virtual bool isParallel() const override {
+		return true;
+	}
+
+private:
+	count k;
+	double epsilon;
+	count levels;
+};
+
+} /* namespace NetworKit */
+
+#endif /* MULTILEVELPARTITIONER_H_ */
@@ -6,8 +6,10 @@
  */
 
 #include "PLP.h"
+#include "LabelWeights.h"
 
 #include <omp.h>
+#include <limits>
 #include "../Globals.h"
 #include "../auxiliary/Log.h"
 #include "../auxiliary/Timer.h"
@@ -23,6 +25,8 @@ PLP::PLP(const Graph& G, const Partition baseClustering, count theta) : Communit
 }
 
 void PLP::run() {
+	typedef index label; // a label is the same as a cluster id
+
 	if (hasRun) {
 		throw std::runtime_error("The algorithm has already run on the graph.");
 	}
@@ -34,8 +38,6 @@ void PLP::run() {
 		result.allToSingletons();
 	}
 
-	typedef index label; // a label is the same as a cluster id
-
 	count n = G.numberOfNodes();
 	// update threshold heuristic
 	if (updateThreshold == none) {
@@ -60,8 +62,28 @@ void PLP::run() {
 	 * In general this does not work. It was changed to: No label was changed in last iteration.
 	 */
 
-	std::vector<bool> activeNodes(z); // record if node must be processed
-	activeNodes.assign(z, true);
+	// the frontier holds the nodes to process, queued[u] marks u as already contained in the next frontier
+	std::vector<node> frontier;
+	frontier.reserve(n);
+	G.forNodes([&](node v) {
+		if (G.degree(v) > 0) {
+			frontier.push_back(v);
+		}
+	});
+	std::vector<uint8_t> queued(z, 1);
+
+	const bool sizeConstrained = (maxLabelSize != none);
+	std::vector<count> labelSize;
+	if (sizeConstrained) {
+		labelSize.assign(result.upperBound(), 0);
+		G.forNodes([&](node v) {
+			++labelSize[result.subsetOf(v)];
+		});
+	}
+
+	const int numThreads = omp_get_max_threads();
+	std::vector<LabelWeights> threadWeights(numThreads);
+	std::vector<std::vector<node>> nextFrontiers(numThreads);
 
 	Aux::Timer runtime;
 
@@ -74,37 +96,76 @@ void PLP::run() {
 		// reset updated
 		nUpdated = 0;
 
-		G.balancedParallelForNodes([&](node v){
-			if ((activeNodes[v]) && (G.degree(v) > 0)) {
+		#pragma omp parallel num_threads(numThreads) reduction(+:nUpdated)
+		{
+			LabelWeights& labelWeights = threadWeights[omp_get_thread_num()];
+			std::vector<node>& next = nextFrontiers[omp_get_thread_num()];
 
-				std::map<label, double> labelWeights; // neighborLabelCounts maps label -> frequency in the neighbors
+			#pragma omp for schedule(guided)
+			for (index i = 0; i < frontier.size(); ++i) {
+				node v = frontier[i];
+				#pragma omp atomic write
+				queued[v] = 0;
 
 				// weigh the labels in the neighborhood of v
+				labelWeights.reset(G.degree(v));
 				G.forNeighborsOf(v, [&](node w, edgeweight weight) {
-					label lw = result.subsetOf(w);
-					labelWeights[lw] += weight; // add weight of edge {v, w}
+					labelWeights.add(result.subsetOf(w), weight);
+				});
+
+				// get heaviest label, ties are broken in favor of the current label and then the smallest label
+				label current = result.subsetOf(v);
+				label heaviest = none;
+				double maxWeight = -std::numeric_limits<double>::infinity();
+				labelWeights.consume([&](label l, double weight) {
+					if (sizeConstrained && l != current) {
+						count size;
+						#pragma omp atomic read
+						size = labelSize[l];
+						if (size >= maxLabelSize) return;
+					}
+					if (weight > maxWeight || (weight == maxWeight && heaviest != current && (l == current || l < heaviest))) {
+						heaviest = l;
+						maxWeight = weight;
+					}
 				});
 
-				// get heaviest label
-				label heaviest = std::max_element(labelWeights.begin(),
-								labelWeights.end(),
-								[](const std::pair<label, edgeweight>& p1, const std::pair<label, edgeweight>& p2) {
-									return p1.second < p2.second;})->first;
-
-				if (result.subsetOf(v) != heaviest) { // UPDATE
-					result.moveToSubset(heaviest,v); //result[v] = heaviest;
-					nUpdated += 1; // TODO: atomic update?
-					G.forNeighborsOf(v, [&](node u) {
-						activeNodes[u] = true;
-					});
-				} else {
-					activeNodes[v] = false;
+				if (heaviest == none || heaviest == current) {
+					continue;
 				}
 
-			} else {
-				// node is isolated
+				if (sizeConstrained) {
+					// another thread may have filled the label in the meantime
+					count newSize;
+					#pragma omp atomic capture
+					newSize = ++labelSize[heaviest];
+					if (newSize > maxLabelSize) {
+						#pragma omp atomic update
+						labelSize[heaviest] -= 1;
+						continue;
+					}
+					#pragma omp atomic update
+					labelSize[current] -= 1;
+				}
+
+				result.moveToSubset(heaviest, v); // UPDATE
+				nUpdated += 1;
+				G.forNeighborsOf(v, [&](node u) {
+					uint8_t wasQueued;
+					#pragma omp atomic capture
+					{ wasQueued = queued[u]; queued[u] = 1; }
+					if (!wasQueued) {
+						next.push_back(u);
+					}
+				});
 			}
-		});
+		}
+
+		frontier.clear();
+		for (std::vector<node>& next : nextFrontiers) {
+			frontier.insert(frontier.end(), next.begin(), next.end());
+			next.clear();
+		}
 
 		// for each while loop iteration...
 
@@ -129,6 +190,14 @@ void PLP::setUpdateThreshold(count th) {
 }
 
 
+void PLP::setMaxLabelSize(count size) {
+	if (size == 0) {
+		throw std::runtime_error("The maximum label size must be positive.");
+	}
+	this->maxLabelSize = size;
+}
+
+
 count PLP::numberOfIterations() {
 	return this->nIterations;
 }
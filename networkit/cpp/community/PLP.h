@@ -22,13 +22,18 @@ namespace NetworKit {
  * that the maximum number of its neighbors have. The procedure is stopped when every vertex
  * has the label that at least half of its neighbors have.
  *
+ * Only nodes with a neighbor whose label changed in the previous iteration are processed again,
+ * and the label weights of a node are summed in a per-thread open-addressing table whose size is
+ * bounded by the maximum degree. Optionally the size of the labels can be capped, which turns PLP
+ * into a size-constrained label propagation as used for coarsening in graph partitioning.
  */
 class PLP: public NetworKit::CommunityDetectionAlgorithm {
 
 protected:
 
 	count updateThreshold = 0;
-	count maxIterations;
+	count maxIterations = none;
+	count maxLabelSize = none;
 	count nIterations = 0; //!< number of iterations in last run
 	std::vector<count> timing;	//!< running times for each iteration
 
@@ -71,6 +76,14 @@ public:
 	*/
 	virtual void setUpdateThreshold(count th);
 
+	/**
+	 * Caps the number of nodes per label: a node does not move to a label which already
+	 * contains @a size nodes. Labels of a base clustering that are larger already can only shrink.
+	 *
+	 * @param size The maximum label size, none (default) for no limit.
+	 */
+	virtual void setMaxLabelSize(count size);
+
 	/**
 	* Get number of iterations in last run.
 	*
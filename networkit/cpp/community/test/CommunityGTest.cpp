@@ -8,6 +8,7 @@
 #include "CommunityGTest.h"
 
 #include "../PLP.h"
+#include "../MultilevelPartitioner.h"
 #include "../PLM.h"
 #include "../ParallelAgglomerativeClusterer.h"
 #include "../../community/Modularity.h"
@@ -148,6 +149,33 @@ TEST_F(CommunityGTest, testLabelPropagationOnManySmallClusters) {
 }
 
 
+TEST_F(CommunityGTest, testLabelPropagationWithMaxLabelSize) {
+	count n = 1000;
+	count k = 10; // number of clusters
+	ClusteredRandomGraphGenerator graphGen(n, k, 0.5, 0.0);
+	Graph G = graphGen.generate();
+
+	count maxSize = 40;
+	PLP lp(G);
+	lp.setMaxLabelSize(maxSize);
+	lp.run();
+	Partition zeta = lp.getPartition();
+
+	EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta)) << "the resulting partition should be a proper clustering";
+	EXPECT_GE(zeta.numberOfSubsets(), n / maxSize);
+	for (auto size : zeta.subsetSizes()) {
+		EXPECT_LE(size, maxSize);
+	}
+
+	// without a cap the planted clusters are found
+	PLP unconstrained(G);
+	unconstrained.run();
+	EXPECT_EQ(k, unconstrained.getPartition().numberOfSubsets());
+
+	EXPECT_THROW(lp.setMaxLabelSize(0), std::runtime_error);
+}
+
+
 
 /*
 TEST_F(CommunityGTest, testLouvainParallel2Naive) {
@@ -748,5 +776,64 @@ TEST_F(CommunityGTest, testPartitionFragmentation) {
 	EXPECT_DOUBLE_EQ(0.9, frag3.getWeightedAverage());
 }
 
+TEST_F(CommunityGTest, testMultilevelPartitioner) {
+	Aux::Random::setSeed(42, false);
+	count n = 2000;
+	count k = 4;
+	double epsilon = 0.03;
+	ClusteredRandomGraphGenerator graphGen(n, 8, 0.05, 0.002);
+	Graph G = graphGen.generate();
+
+	MultilevelPartitioner partitioner(G, k, epsilon);
+	partitioner.run();
+	Partition part = partitioner.getPartition();
+	EXPECT_GT(partitioner.numberOfLevels(), 1u);
+
+	count maxBlockSize = std::floor((1.0 + epsilon) * std::ceil(n / (double) k));
+	std::vector<count> sizes(k, 0);
+	G.forNodes([&](node v) {
+		ASSERT_LT(part[v], k);
+		++sizes[part[v]];
+	});
+	for (count size : sizes) {
+		EXPECT_LE(size, maxBlockSize);
+	}
+
+	// the partitioner should cut far fewer edges than a random partition
+	EdgeCut cut;
+	ClusteringGenerator generator;
+	Partition random = generator.makeRandomClustering(G, k);
+	EXPECT_LT(cut.getQuality(part, G), 0.5 * cut.getQuality(random, G));
+
+	EXPECT_THROW(MultilevelPartitioner(G, 0), std::runtime_error);
+}
+
+TEST_F(CommunityGTest, testMultilevelPartitionerBalanceWithIsolatedAndDeletedNodes) {
+	// a star, whose center has to end up in some block with few of its leaves, plus isolated nodes
+	count n = 300;
+	Graph G(n);
+	for (node v = 1; v < 200; ++v) {
+		G.addEdge(0, v);
+	}
+	for (node v = 200; v < 220; ++v) {
+		G.removeNode(v);
+	}
+
+	count k = 3;
+	MultilevelPartitioner partitioner(G, k, 0.0);
+	partitioner.run();
+	Partition part = partitioner.getPartition();
+
+	count maxBlockSize = (G.numberOfNodes() + k - 1) / k;
+	std::vector<count> sizes(k, 0);
+	G.forNodes([&](node v) {
+		ASSERT_LT(part[v], k);
+		++sizes[part[v]];
+	});
+	for (count size : sizes) {
+		EXPECT_LE(size, maxBlockSize);
+	}
+	EXPECT_EQ(none, part[205]);
+}
 
 } /* namespace NetworKit */
@@ -9,6 +9,7 @@
 #include "AlgebraicDistance.h"
 
 #include "../auxiliary/Timer.h"
+#include "../auxiliary/Random.h"
 #include <omp.h>
 
 
@@ -25,9 +26,10 @@ void AlgebraicDistance::randomInit() {
 	// allocate space for loads
 	loads.resize(numSystems*G.upperNodeIdBound());
 
+	const uint64_t seed = Aux::Random::integer();
 	#pragma omp parallel for
 	for (index i = 0; i < loads.size(); ++i) {
-		loads[i] = Aux::Random::real();
+		loads[i] = Aux::Random::SplitMix64(seed, i).real();
 	}
 }
 
@@ -61,6 +61,7 @@ void CommuteTimeDistance::run() {
 		rhs[u] = 0.0;
 		rhs[v] = 0.0;
 	});
+	sketch.reset();
 	exactly = true;
 	hasRun = true;
 }
@@ -81,6 +82,7 @@ void CommuteTimeDistance::runApproximation() {
 	double randTab[3] = {1/sqrt(k), -1/sqrt(k)};
 	solutions.clear();
 	solutions.resize(k, Vector(n));
+	sketch.reset();
 
 	for (index i = 0; i < k; ++i) {
 		Vector rhs(n, 0.0);
@@ -114,48 +116,11 @@ void CommuteTimeDistance::runApproximation() {
 }
 
 void CommuteTimeDistance::runParallelApproximation() {
-	count n = G.numberOfNodes();
-	// distances.clear();
-	// distances.resize(n);
-	// G.forNodes([&](node v){
-	// 	distances[v].resize(n, 0.0);
-	// });
-	double epsilon2 = tol * tol;
-	k = ceil(log2(n)) / epsilon2;
-	double randTab[3] = {1/sqrt(k), -1/sqrt(k)};
+	sketch.reset(new EffectiveResistanceSketch(G, lamg, tol));
+	sketch->run();
+	k = sketch->getSketchDimension();
 	solutions.clear();
-	solutions.resize(k, Vector(n));
-	std::vector<Vector> rhs(k, Vector(n));
-
 	INFO("Number k of iterations: ", k);
-#pragma omp parallel for
-	for (index i = 0; i < k; ++i) {
-		// rhs(v) = \sum_e=1 ^m q(e) * B(e, v)
-		//        = +/- q(e)
-		G.forEdges([&](node u, node v) {
-			double r = randTab[Aux::Random::integer(1)];
-
-			if (u < v) {
-				rhs[i][u] += r;
-				rhs[i][v] -= r;
-			}
-			else {
-				rhs[i][u] -= r;
-				rhs[i][v] += r;
-			}
-		});
-	}
-	INFO("Starting the solve phase");
-	lamg.parallelSolve(rhs, solutions);
-	INFO("Done with the solve phase");
-
-	// for (index i = 0; i < k; ++i) {
-	// 	G.parallelForNodePairs([&](node u, node v){
-	// 		double diff = solutions[i][u] - solutions[i][v];
-	// 		distances[u][v] += diff * diff; // TODO: fix weighted case!
-	// 		distances[v][u] += diff * diff; // TODO: fix weighted case!
-	// 	});
-	// }
 	exactly = false;
 	hasRun = true;
 }
@@ -164,6 +129,8 @@ double CommuteTimeDistance::distance(node u, node v) {
 	if (!hasRun) throw std::runtime_error("Call run method first");
 	if (exactly) {
 		return sqrt(distances[u][v]* G.numberOfEdges()); // TODO fix weighted case: volume is the sum of the weights of the edges
+	} else if (sketch) {
+		return sqrt(sketch->effectiveResistance(u, v) * G.numberOfEdges());
 	} else {
 		double dist = 0;
 		for (index i = 0; i < k; ++i) {
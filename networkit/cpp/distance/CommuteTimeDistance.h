@@ -12,6 +12,9 @@
 #include "../numerics/LAMG/Lamg.h"
 #include "../graph/Graph.h"
 #include "../base/Algorithm.h"
+#include "EffectiveResistanceSketch.h"
+
+#include <memory>
 
 
 namespace NetworKit {
@@ -48,7 +51,9 @@ public:
 	void runApproximation();
 
 	/**
-	 * Computes approximation by projection, in parallel.
+	 * Computes approximation by projection, in parallel. The projections are solved as blocks of right-hand sides
+	 * over the shared LAMG hierarchy (see EffectiveResistanceSketch), afterwards each call of @ref distance reads
+	 * O(log n / tol^2) contiguous values.
 	 */
 	void runParallelApproximation();
 	/**
@@ -81,6 +86,7 @@ protected:
 	uint64_t setupTime;
 	std::vector<std::vector<double>> distances;
 	std::vector<Vector> solutions;
+	std::unique_ptr<EffectiveResistanceSketch> sketch;
 	bool hasRun = false;
 	bool exactly;
 	count k;
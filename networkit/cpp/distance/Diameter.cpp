@@ -8,12 +8,9 @@
 #include <numeric>
 
 #include "Diameter.h"
-#include "Eccentricity.h"
+#include "EccentricityBounding.h"
 #include "../graph/BFS.h"
-#include "../graph/Dijkstra.h"
 #include "../components/ConnectedComponents.h"
-#include "../structures/Partition.h"
-#include "../graph/BFS.h"
 
 namespace NetworKit {
 
@@ -51,182 +48,17 @@ std::pair<count, count> Diameter::getDiameter() const {
 }
 
 edgeweight Diameter::exactDiameter(const Graph& G) {
-	using namespace std;
-
-	Aux::SignalHandler handler;
-
-	edgeweight diameter = 0.0;
-
-	if (! G.isWeighted()) {
-		std::tie(diameter, std::ignore) = estimatedDiameterRange(G, 0);
-	} else {
-		G.forNodes([&](node v) {
-			handler.assureRunning();
-			Dijkstra dijkstra(G, v);
-			dijkstra.run();
-			auto distances = dijkstra.getDistances();
-			G.forNodes([&](node u) {
-				if (diameter < distances[u]) {
-					diameter = distances[u];
-				}
-			});
-		});
-	}
-
-	if (diameter == std::numeric_limits<edgeweight>::max()) {
-		throw std::runtime_error("Graph not connected - diameter is infinite");
-	}
-	return diameter;
+	EccentricityBounding bounding(G);
+	bounding.run();
+	INFO(bounding.numberOfSearches(), " searches used");
+	return bounding.getDiameter().first;
 }
 
 std::pair<edgeweight, edgeweight> Diameter::estimatedDiameterRange(const NetworKit::Graph &G, double error) {
-	if (G.isDirected() || G.isWeighted()) {
-		throw std::runtime_error("Error, the diameter of directed or weighted graphs cannot be computed yet.");
-	}
-
-	Aux::SignalHandler handler;
-	/*
-	 * This is an implementation of a slightly modified version of the exactSumSweep algorithm as presented in
-	 * Fast diameter and radius BFS-based computation in (weakly connected) real-world graphs: With an application to the six degrees of separation games
-	 * by Michele Borassi, Pierluigi Crescenzi, Michel Habib, Walter A. Kosters, Andrea Marino, Frank W. Takes
-	 * http://www.sciencedirect.com/science/article/pii/S0304397515001644
-	 */
-
-	std::vector<count> eccLowerBound(G.upperNodeIdBound()), eccUpperBound(G.upperNodeIdBound());
-	std::vector<bool> finished(G.upperNodeIdBound());
-
-	for (node u = 0; u < G.upperNodeIdBound(); ++u) {
-		if (G.hasNode(u)) {
-			eccUpperBound[u] = G.numberOfNodes();
-		}
-	}
-
-	ConnectedComponents comp(G);
-	comp.run();
-	count numberOfComponents = comp.numberOfComponents();
-
-
-	std::vector<count> distFirst(numberOfComponents, 0);
-	std::vector<count> ecc(numberOfComponents, 0);
-	std::vector<count> distances(G.upperNodeIdBound(), 0);
-
-	count numBFS = 0;
-
-	auto runBFS = [&](const std::vector<node> &startNodes) {
-		++numBFS;
-		std::vector<bool> foundFirstDeg2Node(numberOfComponents, false);
-
-		G.BFSfrom(startNodes, [&](node v, count dist) {
-			distances[v] = dist;
-
-			index c = comp.componentOfNode(v);
-			ecc[c] = std::max(dist, ecc[c]);
-
-			if (!foundFirstDeg2Node[c] && G.degree(v) > 1) {
-				foundFirstDeg2Node[c] = true;
-				distFirst[c] = dist;
-			}
-		});
-
-		G.forNodes([&](node u) {
-			if (finished[u]) return;
-
-			auto c = comp.componentOfNode(u);
-
-			auto eccValue = std::max(distances[u], ecc[c] - distances[u]);
-			eccLowerBound[u] = std::max(eccValue, eccLowerBound[u]);
-
-			if (distances[u] <= distFirst[c]) {
-				eccUpperBound[u] = eccValue;
-			} else {
-				eccUpperBound[u] = std::min(eccUpperBound[u], distances[u] + ecc[c] - 2 * distFirst[c]);
-			}
-
-			finished[u] = (eccUpperBound[u] == eccLowerBound[u]);
-		});
-
-		ecc.clear();
-		ecc.resize(numberOfComponents, 0);
-		distFirst.clear();
-		distFirst.resize(numberOfComponents, 0);
-	};
-
-	auto diameterBounds = [&]() {
-		count maxExact = *std::max_element(eccLowerBound.begin(), eccLowerBound.end());
-		count maxPotential = *std::max_element(eccUpperBound.begin(), eccUpperBound.end());
-		return std::make_pair(maxExact, maxPotential);
-	};
-
-	std::vector<node> startNodes(numberOfComponents, 0), maxDist(numberOfComponents, 0);
-	std::vector<count> maxDeg(numberOfComponents, 0);
-
-	count lb = 0, ub = G.numberOfNodes();
-
-	auto printStartNodes = [&]() {
-		DEBUG("Start nodes (lb = ", lb, ", ub = ", ub, "): ");
-		for (node u : startNodes) {
-			(void)u; // prevent unused variable warning
-			DEBUG("Node ", u, " with distance ", distances[u], ", lower bound ", eccLowerBound[u], ", upper bound ", eccUpperBound[u]);
-		}
-	};
-
-	// for each component, find the node with the maximum degreee and add it as start node
-	G.forNodes([&](node v) {
-		count d = G.degree(v);
-		count c = comp.componentOfNode(v);
-		if (d >= maxDeg[c]) {
-			startNodes[c] = v;
-			maxDeg[c] = d;
-		}
-	});
-
-	handler.assureRunning();
-
-	runBFS(startNodes);
-
-	std::tie(lb, ub) = diameterBounds();
-
-	for (index i = 0; i < 2*G.numberOfNodes() && ub > (lb + error*lb); ++i) {
-		handler.assureRunning();
-		startNodes.clear();
-		startNodes.resize(numberOfComponents, none);
-
-		if ((i % 2) == 0) {
-			G.forNodes([&](node u) {
-				auto c = comp.componentOfNode(u);
-				if (startNodes[c] == none || std::tie(eccUpperBound[u], distances[u]) > std::tie(eccUpperBound[startNodes[c]], distances[startNodes[c]])) {
-					startNodes[c] = u;
-				}
-			});
-		} else {
-			G.forNodes([&](node u) {
-				auto c = comp.componentOfNode(u);
-				// Idea: we select a node that is central (i.e. has a low lower bound) but that is also close to the previous, non-central node.
-				// More generally, the best upper bound we can hope for a node v is eccLowerBound[u] + distance(u, v).
-				// We select the node the provides the best upper bound for the previous node u in the hope that in its neighborhood there are more nodes for which the bounds can be decreased.
-				// Among all these nodes we select the one that has the largest distance to the previous start node.
-				if (startNodes[c] == none) {
-					startNodes[c] = u;
-				} else {
-					auto compU = eccLowerBound[u] + distances[u], compStart = eccLowerBound[startNodes[c]] + distances[startNodes[c]];
-					if (compU < compStart || (compU == compStart && distances[u] > distances[startNodes[c]])) {
-						startNodes[c] = u;
-					}
-				}
-			});
-		}
-
-		handler.assureRunning();
-
-		printStartNodes();
-		runBFS(startNodes);
-
-		std::tie(lb, ub) = diameterBounds();
-	}
-
-	INFO(numBFS, " BFS used");
-
-	return {lb, ub};
+	EccentricityBounding bounding(G, false, error);
+	bounding.run();
+	INFO(bounding.numberOfSearches(), " searches used");
+	return bounding.getDiameter();
 }
 
 edgeweight Diameter::estimatedVertexDiameter(const Graph& G, count samples) {
@@ -40,12 +40,9 @@ private:
 	std::pair<count, count> diameterBounds;
 
 	/**
-	 * Get the an estimation of the diameter of the graph @a G. The algorithm is based on the ExactSumSweep algorithm presented in
-	 * Michele Borassi, Pierluigi Crescenzi, Michel Habib, Walter A. Kosters, Andrea Marino, Frank W. Takes,
-	 * Fast diameter and radius BFS-based computation in (weakly connected) real-world graphs: With an application to the six degrees of separation games,
-	 * Theoretical Computer Science, Volume 586, 27 June 2015, Pages 59-80, ISSN 0304-3975,
-	 * http://dx.doi.org/10.1016/j.tcs.2015.02.033.
-	 * (http://www.sciencedirect.com/science/article/pii/S0304397515001644)
+	 * Get an estimation of the diameter of the graph @a G by parallel refinement of eccentricity bounds,
+	 * see EccentricityBounding. Directed graphs have to be strongly connected, on undirected graphs
+	 * the largest diameter of a connected component is returned.
 	 * @param G The graph.
 	 * @param error The maximum allowed relative error. Set to 0 for the exact diameter.
 	 * @return Pair of lower and upper bound for diameter.
@@ -53,7 +50,7 @@ private:
 	std::pair<edgeweight, edgeweight> estimatedDiameterRange(const Graph& G, double error);
 
 	/**
-	 * Get the exact diameter of the graph @a G. The algorithm for unweighted graphs is the same as
+	 * Get the exact diameter of the graph @a G. The algorithm is the same as
 	 * the algorithm for the estimated diameter range with error 0.
 	 *
 	 * @param G The graph.
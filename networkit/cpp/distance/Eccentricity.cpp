@@ -6,6 +6,7 @@
  */
 
 #include "Eccentricity.h"
+#include "EccentricityBounding.h"
 #include "../graph/BFS.h"
 
 namespace NetworKit {
@@ -20,6 +21,12 @@ std::pair<node, count> Eccentricity::getValue(const Graph& G, node u) {
 	return {res, ecc}; // pair.first is argmax node
 }
 
+std::vector<edgeweight> Eccentricity::getValues(const Graph& G) {
+	EccentricityBounding bounding(G, true);
+	bounding.run();
+	return bounding.getEccentricities();
+}
+
 
 } /* namespace NetworKit */
 
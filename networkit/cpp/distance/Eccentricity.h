@@ -23,6 +23,16 @@ public:
 	 * TODO: documentation
 	 */
 	static std::pair<node, count> getValue(const Graph& G, node u);
+
+	/**
+	 * Computes the eccentricities of all nodes with concurrent searches that refine eccentricity bounds,
+	 * so that far fewer than n searches are needed on most real-world graphs. See EccentricityBounding
+	 * for weighted and directed graphs.
+	 *
+	 * @param G The graph.
+	 * @return The eccentricity of every node, 0 for deleted nodes.
+	 */
+	static std::vector<edgeweight> getValues(const Graph& G);
 };
 
 } /* namespace NetworKit */
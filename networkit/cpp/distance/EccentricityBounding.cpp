@@ -0,0 +1,297 @@
+/*
+ * EccentricityBounding.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "EccentricityBounding.h"
+#include "../auxiliary/Parallel.h"
+#include "../auxiliary/SignalHandling.h"
+#include "../components/ConnectedComponents.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <omp.h>
+
+namespace NetworKit {
+
+namespace {
+
+const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+
+/**
+ * Distances of one search. Only the entries of reached nodes are reset, so a search costs O(reached nodes + edges).
+ */
+struct SearchSpace {
+	std::vector<edgeweight> distance;
+	std::vector<node> reached;
+	std::vector<std::pair<edgeweight, node>> heap;
+
+	explicit SearchSpace(count z) : distance(z, infDist) {}
+};
+
+/**
+ * Computes the distances from @a s, or to @a s if @a backward is set, by BFS or Dijkstra.
+ * @return the largest distance
+ */
+edgeweight search(const Graph& G, node s, bool backward, SearchSpace& space) {
+	std::vector<edgeweight>& distance = space.distance;
+	std::vector<node>& reached = space.reached;
+	for (node v : reached) {
+		distance[v] = infDist;
+	}
+	reached.clear();
+	distance[s] = 0;
+	reached.push_back(s);
+
+	edgeweight ecc = 0;
+	if (!G.isWeighted()) {
+		// the reached nodes are in BFS order, so they double as the queue
+		for (index head = 0; head < reached.size(); ++head) {
+			node u = reached[head];
+			ecc = distance[u];
+			auto visit = [&](node v) {
+				if (distance[v] == infDist) {
+					distance[v] = ecc + 1;
+					reached.push_back(v);
+				}
+			};
+			if (backward) {
+				G.forInNeighborsOf(u, visit);
+			} else {
+				G.forNeighborsOf(u, visit);
+			}
+		}
+	} else {
+		auto& heap = space.heap;
+		auto later = std::greater<std::pair<edgeweight, node>>();
+		heap.assign(1, std::make_pair(0.0, s));
+		while (!heap.empty()) {
+			std::pop_heap(heap.begin(), heap.end(), later);
+			edgeweight d = heap.back().first;
+			node u = heap.back().second;
+			heap.pop_back();
+			if (d > distance[u]) {
+				continue;
+			}
+			ecc = std::max(ecc, d);
+			auto relax = [&](node v, edgeweight w) {
+				if (d + w < distance[v]) {
+					if (distance[v] == infDist) {
+						reached.push_back(v);
+					}
+					distance[v] = d + w;
+					heap.push_back(std::make_pair(d + w, v));
+					std::push_heap(heap.begin(), heap.end(), later);
+				}
+			};
+			if (backward) {
+				G.forInEdgesOf(u, [&](node, node v, edgeweight w) {
+					relax(v, w);
+				});
+			} else {
+				G.forNeighborsOf(u, relax);
+			}
+		}
+	}
+	return ecc;
+}
+
+} /* anonymous namespace */
+
+EccentricityBounding::EccentricityBounding(const Graph& G, bool allEccentricities, double error) : Algorithm(), G(G), allEccentricities(allEccentricities), error(error), diameterBounds(0, 0), searches(0) {
+	if (error < 0) {
+		throw std::runtime_error("The error must not be negative.");
+	}
+}
+
+void EccentricityBounding::run() {
+	Aux::SignalHandler handler;
+	const count z = G.upperNodeIdBound();
+	const count n = G.numberOfNodes();
+	const count threads = omp_get_max_threads();
+
+	std::vector<std::atomic<edgeweight>> low(z), up(z);
+	G.parallelForNodes([&](node v) {
+		low[v] = 0;
+		// isolated nodes of undirected graphs are done
+		up[v] = (G.degree(v) == 0 && !G.isDirected()) ? 0 : infDist;
+	});
+
+	// the bounds of different components do not interact, so each component is refined on its own and a round
+	// costs time linear in the size of its component instead of the graph; directed graphs have to be strongly connected
+	std::vector<std::vector<node>> components;
+	if (G.isDirected()) {
+		components.push_back(G.nodes());
+	} else {
+		ConnectedComponents cc(G);
+		cc.run();
+		components = cc.getComponents();
+	}
+
+	std::vector<SearchSpace> forward(threads, SearchSpace(z));
+	std::vector<SearchSpace> backward(G.isDirected() ? threads : 0, SearchSpace(z));
+
+	// the largest lower bound of the diameter over all components, nodes with smaller upper bounds are not searched from
+	std::atomic<edgeweight> diameterLower(0);
+	bool stronglyConnected = true;
+	searches = 0;
+
+	// refines the bounds of the nodes of one component with batches of up to width concurrent searches; a batch of
+	// one search runs in the calling thread with the search spaces of thread
+	auto refine = [&](const std::vector<node>& nodes, count width, index thread) {
+		std::vector<node> candidates, byUpper, byLower, batch;
+		std::vector<edgeweight> eccentricities;
+		if (!G.isWeighted()) {
+			// no shortest path in a component is longer than its number of nodes minus one
+			for (node v : nodes) {
+				Aux::Parallel::atomic_min(up[v], (edgeweight) nodes.size() - 1);
+			}
+		}
+		for (count round = 0; handler.isRunning() && stronglyConnected; ++round) {
+			edgeweight componentLower = 0, componentUpper = 0;
+			for (node v : nodes) {
+				componentLower = std::max(componentLower, low[v].load(std::memory_order_relaxed));
+				componentUpper = std::max(componentUpper, up[v].load(std::memory_order_relaxed));
+			}
+			Aux::Parallel::atomic_max(diameterLower, componentLower);
+			edgeweight threshold = diameterLower;
+			if (!allEccentricities && componentUpper <= threshold * (1 + error)) {
+				break;
+			}
+
+			// unfinished nodes, only those that can raise the diameter if it is the goal
+			candidates.clear();
+			for (node v : nodes) {
+				if (low[v] < up[v] && (allEccentricities || up[v] > threshold)) {
+					candidates.push_back(v);
+				}
+			}
+			if (candidates.empty()) {
+				break;
+			}
+
+			// alternately the candidates with the largest upper and with the smallest lower bound, ties broken by degree
+			count size = std::min(width, (count) candidates.size());
+			byUpper = candidates;
+			std::partial_sort(byUpper.begin(), byUpper.begin() + size, byUpper.end(), [&](node a, node b) {
+				return std::make_tuple(up[a].load(), G.degree(a), b) > std::make_tuple(up[b].load(), G.degree(b), a);
+			});
+			byLower = candidates;
+			std::partial_sort(byLower.begin(), byLower.begin() + size, byLower.end(), [&](node a, node b) {
+				return std::make_tuple(-low[a].load(), G.degree(a), b) > std::make_tuple(-low[b].load(), G.degree(b), a);
+			});
+			batch.clear();
+			for (index i = 0, j = 0; batch.size() < size; ) {
+				bool takeUpper = (round + batch.size()) % 2 == 0 ? i < size : j >= size;
+				node v = takeUpper ? byUpper[i++] : byLower[j++];
+				if (std::find(batch.begin(), batch.end(), v) == batch.end()) {
+					batch.push_back(v);
+				}
+			}
+
+			eccentricities.assign(batch.size(), 0);
+			#pragma omp parallel for schedule(dynamic, 1) if(width > 1)
+			for (index b = 0; b < batch.size(); ++b) {
+				index tid = width > 1 ? omp_get_thread_num() : thread;
+				node v = batch[b];
+				SearchSpace& out = forward[tid];
+				edgeweight ecc = search(G, v, false, out);
+				eccentricities[b] = ecc;
+				if (G.isDirected()) {
+					SearchSpace& in = backward[tid];
+					search(G, v, true, in);
+					if (out.reached.size() < n || in.reached.size() < n) {
+						#pragma omp atomic write
+						stronglyConnected = false;
+					}
+					for (node w : out.reached) {
+						Aux::Parallel::atomic_max(low[w], ecc - out.distance[w]);
+					}
+					for (node w : in.reached) {
+						Aux::Parallel::atomic_max(low[w], in.distance[w]);
+						Aux::Parallel::atomic_min(up[w], in.distance[w] + ecc);
+					}
+				} else {
+					for (node w : out.reached) {
+						edgeweight d = out.distance[w];
+						Aux::Parallel::atomic_max(low[w], std::max(d, ecc - d));
+						Aux::Parallel::atomic_min(up[w], d + ecc);
+					}
+				}
+			}
+			// the searched nodes are exact, regardless of rounding in the bounds of the other searches
+			for (index b = 0; b < batch.size(); ++b) {
+				low[batch[b]] = eccentricities[b];
+				up[batch[b]] = eccentricities[b];
+			}
+			#pragma omp atomic update
+			searches += batch.size();
+		}
+	};
+
+	// components too large to balance among the threads are refined one after the other with concurrent searches,
+	// the others concurrently with one search at a time, largest first
+	std::sort(components.begin(), components.end(), [](const std::vector<node>& a, const std::vector<node>& b) {
+		return a.size() > b.size();
+	});
+	index small = 0;
+	while (small < components.size() && components[small].size() * threads >= n && threads > 1) {
+		refine(components[small], threads, 0);
+		++small;
+	}
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index c = small; c < components.size(); ++c) {
+		refine(components[c], 1, omp_get_thread_num());
+	}
+	handler.assureRunning();
+	if (!stronglyConnected) {
+		throw std::runtime_error("Graph not strongly connected - diameter is infinite");
+	}
+
+	edgeweight diameterUpper = 0;
+	G.forNodes([&](node v) {
+		diameterUpper = std::max(diameterUpper, up[v].load(std::memory_order_relaxed));
+	});
+
+	lower.assign(z, 0);
+	upper.assign(z, 0);
+	G.parallelForNodes([&](node v) {
+		lower[v] = low[v];
+		upper[v] = up[v];
+	});
+	diameterBounds = std::make_pair(diameterLower.load(), allEccentricities ? diameterLower.load() : diameterUpper);
+	hasRun = true;
+}
+
+std::pair<edgeweight, edgeweight> EccentricityBounding::getDiameter() const {
+	assureFinished();
+	return diameterBounds;
+}
+
+std::vector<edgeweight> EccentricityBounding::getEccentricities() const {
+	assureFinished();
+	if (!allEccentricities) {
+		throw std::runtime_error("The eccentricities of all nodes have not been computed.");
+	}
+	return lower;
+}
+
+std::vector<edgeweight> EccentricityBounding::getLowerBounds() const {
+	assureFinished();
+	return lower;
+}
+
+std::vector<edgeweight> EccentricityBounding::getUpperBounds() const {
+	assureFinished();
+	return upper;
+}
+
+count EccentricityBounding::numberOfSearches() const {
+	assureFinished();
+	return searches;
+}
+
+} /* namespace NetworKit */
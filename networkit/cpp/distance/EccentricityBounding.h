@@ -0,0 +1,83 @@
+/*
+ * EccentricityBounding.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef ECCENTRICITYBOUNDING_H_
+#define ECCENTRICITYBOUNDING_H_
+
+#include "../base/Algorithm.h"
+#include "../graph/Graph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Computes the diameter or all eccentricities of a graph by refining lower and upper bounds on the eccentricities
+ * of all nodes, following the BoundingDiameters algorithm presented in
+ * Frank W. Takes, Walter A. Kosters, Computing the Eccentricity Distribution of Large Graphs,
+ * Algorithms 6(1): 100-118, 2013, http://dx.doi.org/10.3390/a6010100
+ *
+ * A search from v yields the eccentricity e(v) and the bounds max(d(w,v), e(v) - d(v,w)) <= e(w) <= d(w,v) + e(v)
+ * for every node w. Each connected component is refined on its own: in every round of a large component one search
+ * per thread runs concurrently, alternately from the unfinished nodes with the largest upper and with the smallest
+ * lower bound, and all searches tighten the shared bounds atomically; smaller components are refined concurrently
+ * with one search per round. When only the diameter is needed, nodes whose upper bound does not exceed the best
+ * lower bound of the diameter are not searched from.
+ *
+ * Unweighted graphs are searched by BFS, weighted graphs by Dijkstra. On undirected graphs the eccentricity of a
+ * node refers to its connected component, so the diameter is the largest diameter of a component. On directed graphs
+ * the eccentricity of v is the largest distance from v, every node searched from is searched forward and backward,
+ * and the graph has to be strongly connected.
+ */
+class EccentricityBounding : public Algorithm {
+
+public:
+	/**
+	 * @param G The graph.
+	 * @param allEccentricities If true, the eccentricities of all nodes are computed, otherwise only the diameter.
+	 * @param error The maximum relative error of the upper bound of the diameter, 0 for the exact diameter.
+	 */
+	EccentricityBounding(const Graph& G, bool allEccentricities = false, double error = 0.0);
+
+	void run() override;
+
+	/**
+	 * @return The lower and the upper bound of the diameter, equal unless an error has been allowed.
+	 */
+	std::pair<edgeweight, edgeweight> getDiameter() const;
+
+	/**
+	 * @return The eccentricity of every node, only available if all eccentricities have been computed.
+	 */
+	std::vector<edgeweight> getEccentricities() const;
+
+	/**
+	 * @return The lower bounds of the eccentricities after run().
+	 */
+	std::vector<edgeweight> getLowerBounds() const;
+
+	/**
+	 * @return The upper bounds of the eccentricities after run(), infinity for nodes no search has reached.
+	 */
+	std::vector<edgeweight> getUpperBounds() const;
+
+	/**
+	 * @return The number of nodes that have been searched from.
+	 */
+	count numberOfSearches() const;
+
+private:
+	const Graph& G;
+	const bool allEccentricities;
+	const double error;
+	std::vector<edgeweight> lower;
+	std::vector<edgeweight> upper;
+	std::pair<edgeweight, edgeweight> diameterBounds;
+	count searches;
+};
+
+} /* namespace NetworKit */
+
+#endif /* ECCENTRICITYBOUNDING_H_ */
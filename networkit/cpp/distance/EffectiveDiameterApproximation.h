@@ -22,14 +22,16 @@ public:
 	/**
 	* Approximates the effective diameter of a given graph.
 	* The effective diameter is defined as the number of edges on average to reach \p ratio of all other nodes.
-	* Implementation after the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
+	* On disconnected graphs every node needs to reach \p ratio of the nodes of its connected component.
+	* The number of reachable nodes is estimated by HyperANF, a variant with HyperLogLog counters of the
+	* ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
 	*
 	* [1] by Palmer, Gibbons and Faloutsos which can be found here: http://www.cs.cmu.edu/~christos/PUBLICATIONS/kdd02-anf.pdf
 	*
 	* @param G the given graph
 	* @param ratio the ratio of nodes that should be connected (0,1]; default = 0.9
-	* @param k the number of parallel approximations to get a more robust result; default = 64
-	* @param r the amount of bits that are added to the length of the bitmask to improve the accuracy; default = 7
+	* @param k the number of registers per counter, rounded up to a power of two in [16, 65536], to get a more robust result; default = 64
+	* @param r ignored, HyperLogLog registers need no additional bits; kept for compatibility
 	*/
 	EffectiveDiameterApproximation(const Graph& G, const double ratio=0.9, const count k=64, const count r=7);
 
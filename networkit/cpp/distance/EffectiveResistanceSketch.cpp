@@ -0,0 +1,143 @@
+/*
+ * EffectiveResistanceSketch.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "EffectiveResistanceSketch.h"
+#include "../auxiliary/Random.h"
+
+#include <cmath>
+#include <sstream>
+#include "omp.h"
+
+namespace NetworKit {
+
+EffectiveResistanceSketch::EffectiveResistanceSketch(const Graph& G, double epsilon) : Algorithm(), G(G), epsilon(epsilon), ownSolver(new Lamg<CSRMatrix>(1e-5)), solver(ownSolver.get()), k(0) {
+	if (epsilon <= 0.0) {
+		throw std::runtime_error("epsilon must be positive");
+	}
+}
+
+EffectiveResistanceSketch::EffectiveResistanceSketch(const Graph& G, Lamg<CSRMatrix>& solver, double epsilon) : Algorithm(), G(G), epsilon(epsilon), solver(&solver), k(0) {
+	if (epsilon <= 0.0) {
+		throw std::runtime_error("epsilon must be positive");
+	}
+}
+
+void EffectiveResistanceSketch::run() {
+	const count n = G.upperNodeIdBound();
+	k = std::max((count) 1, (count) std::ceil(std::log2(std::max(n, (count) 2)) / (epsilon * epsilon)));
+	const double scale = 1.0 / std::sqrt(k);
+
+	// fixed edge order, every projection draws one sign per edge from its own stream
+	std::vector<node> tails;
+	std::vector<node> heads;
+	std::vector<double> scaledWeights;
+	tails.reserve(G.numberOfEdges());
+	heads.reserve(G.numberOfEdges());
+	scaledWeights.reserve(G.numberOfEdges());
+	G.forEdges([&](node u, node v, edgeweight w) {
+		if (u != v) {
+			tails.push_back(u);
+			heads.push_back(v);
+			scaledWeights.push_back(std::sqrt(w) * scale);
+		}
+	});
+
+	sketch.assign(n * k, 0.0);
+	if (tails.empty()) {
+		hasRun = true;
+		return;
+	}
+
+	if (ownSolver) {
+		ownSolver->setup(CSRMatrix::laplacianMatrix(G));
+	}
+
+	// the right-hand sides and solutions of one block are all that is kept besides the sketch
+	const count blockSize = std::min(k, (count) (4 * omp_get_max_threads()));
+	uint64_t seed = Aux::Random::integer();
+	std::vector<Vector> rhs;
+	std::vector<Vector> solutions;
+	for (index first = 0; first < k; first += blockSize) {
+		const count size = std::min(blockSize, k - first);
+		rhs.resize(size);
+		solutions.resize(size);
+
+#pragma omp parallel for
+		for (index b = 0; b < size; ++b) {
+			// rhs = B^T W^(1/2) q for a random sign vector q
+			Aux::Random::SplitMix64 urng(seed, first + b);
+			rhs[b] = Vector(n, 0.0);
+			solutions[b] = Vector(n, 0.0);
+			uint64_t bits = 0;
+			for (index e = 0; e < tails.size(); ++e) {
+				if ((e & 63) == 0) bits = urng();
+				double r = (bits & 1) ? scaledWeights[e] : -scaledWeights[e];
+				bits >>= 1;
+				rhs[b][tails[e]] += r;
+				rhs[b][heads[e]] -= r;
+			}
+		}
+
+		solver->parallelSolve(rhs, solutions);
+
+#pragma omp parallel for
+		for (index u = 0; u < n; ++u) {
+			double* row = &sketch[u * k + first];
+			for (index b = 0; b < size; ++b) {
+				row[b] = solutions[b][u];
+			}
+		}
+	}
+
+	hasRun = true;
+}
+
+double EffectiveResistanceSketch::effectiveResistance(node u, node v) const {
+	assureFinished();
+	const double* zu = &sketch[u * k];
+	const double* zv = &sketch[v * k];
+	double resistance = 0.0;
+	for (index i = 0; i < k; ++i) {
+		double diff = zu[i] - zv[i];
+		resistance += diff * diff;
+	}
+	return resistance;
+}
+
+std::vector<double> EffectiveResistanceSketch::effectiveResistances(const std::vector<std::pair<node, node>>& pairs) const {
+	assureFinished();
+	std::vector<double> resistances(pairs.size());
+#pragma omp parallel for
+	for (index i = 0; i < pairs.size(); ++i) {
+		resistances[i] = effectiveResistance(pairs[i].first, pairs[i].second);
+	}
+	return resistances;
+}
+
+std::vector<double> EffectiveResistanceSketch::edgeScores() const {
+	assureFinished();
+	if (!G.hasEdgeIds()) {
+		throw std::runtime_error("edges have not been indexed - call indexEdges first");
+	}
+	std::vector<double> scores(G.upperEdgeIdBound(), 0.0);
+	G.parallelForEdges([&](node u, node v, edgeweight w, edgeid e) {
+		scores[e] = w * effectiveResistance(u, v);
+	});
+	return scores;
+}
+
+count EffectiveResistanceSketch::getSketchDimension() const {
+	assureFinished();
+	return k;
+}
+
+std::string EffectiveResistanceSketch::toString() const {
+	std::stringstream stream;
+	stream << "EffectiveResistanceSketch(epsilon=" << epsilon << ")";
+	return stream.str();
+}
+
+} /* namespace NetworKit */
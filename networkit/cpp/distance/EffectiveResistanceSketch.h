@@ -0,0 +1,91 @@
+/*
+ * EffectiveResistanceSketch.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef EFFECTIVERESISTANCESKETCH_H_
+#define EFFECTIVERESISTANCESKETCH_H_
+
+#include "../algebraic/CSRMatrix.h"
+#include "../numerics/LAMG/Lamg.h"
+#include "../graph/Graph.h"
+#include "../base/Algorithm.h"
+
+#include <memory>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Johnson-Lindenstrauss sketch of the effective resistances of a graph (Spielman, Srivastava: "Graph sparsification
+ * by effective resistances"). With Q a random k x m matrix of entries +/-1/sqrt(k), W the edge weights and B the
+ * incidence matrix, the rows of Z = Q W^(1/2) B L^+ embed the nodes such that ||Z(u) - Z(v)||^2 approximates the
+ * effective resistance between u and v within a factor of 1 +/- epsilon with high probability, k = log2(n) / epsilon^2.
+ *
+ * The k Laplacian systems share one LAMG hierarchy and are solved in blocks by Lamg::parallelSolve. The sketch is
+ * stored node-major, so that after run() a pair query costs O(k) contiguous reads and no further solves.
+ * Resistances are only meaningful for nodes of the same connected component.
+ */
+class EffectiveResistanceSketch : public Algorithm {
+public:
+	/**
+	 * Creates the sketch for @a G with its own solver, which is set up by run().
+	 * @param G The graph.
+	 * @param epsilon Approximation parameter.
+	 */
+	EffectiveResistanceSketch(const Graph& G, double epsilon = 0.1);
+
+	/**
+	 * Creates the sketch for @a G using @a solver, which has to be set up for the Laplacian of @a G already.
+	 * @param G The graph.
+	 * @param solver LAMG solver of the Laplacian of @a G.
+	 * @param epsilon Approximation parameter.
+	 */
+	EffectiveResistanceSketch(const Graph& G, Lamg<CSRMatrix>& solver, double epsilon = 0.1);
+
+	/**
+	 * Draws the random projection and solves the k Laplacian systems.
+	 */
+	void run() override;
+
+	/**
+	 * @return The (approximate) effective resistance between @a u and @a v.
+	 */
+	double effectiveResistance(node u, node v) const;
+
+	/**
+	 * @return The (approximate) effective resistances of all @a pairs, computed in parallel.
+	 */
+	std::vector<double> effectiveResistances(const std::vector<std::pair<node, node>>& pairs) const;
+
+	/**
+	 * @return The weight times the effective resistance of every edge, indexed by edge id. This is the spanning edge
+	 * centrality, i.e. the fraction of spanning trees containing the edge in the unweighted case. The graph's edges
+	 * have to be indexed.
+	 */
+	std::vector<double> edgeScores() const;
+
+	/**
+	 * @return The number k of random projections.
+	 */
+	count getSketchDimension() const;
+
+	std::string toString() const override;
+
+	bool isParallel() const override {
+		return true;
+	}
+
+private:
+	const Graph& G;
+	double epsilon;
+	std::unique_ptr<Lamg<CSRMatrix>> ownSolver;
+	Lamg<CSRMatrix>* solver;
+	count k;
+	std::vector<double> sketch; // k consecutive entries per node
+};
+
+} /* namespace NetworKit */
+
+#endif /* EFFECTIVERESISTANCESKETCH_H_ */
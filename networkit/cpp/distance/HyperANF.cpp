@@ -0,0 +1,202 @@
+/*
+* HyperANF.cpp
+*
+*  Created on: 18.10.2026
+*/
+
+#include "HyperANF.h"
+#include "../auxiliary/Random.h"
+
+#include <algorithm>
+#include <cmath>
+#include <omp.h>
+
+namespace NetworKit {
+
+namespace {
+
+/**
+ * Register-wise maximum, the union of two HyperLogLog counters. The loop has no dependencies between iterations,
+ * so the compiler turns it into packed byte maxima.
+ */
+inline void unite(uint8_t* target, const uint8_t* source, count m) {
+	for (index j = 0; j < m; ++j) {
+		target[j] = std::max(target[j], source[j]);
+	}
+}
+
+template<typename T>
+void concatenate(const std::vector<std::vector<T>>& local, std::vector<T>& result) {
+	result.clear();
+	for (const auto& part : local) {
+		result.insert(result.end(), part.begin(), part.end());
+	}
+}
+
+} /* anonymous namespace */
+
+HyperANF::HyperANF(const Graph& G, const count registerBits, const count maxDistance) : Algorithm(), G(G), registerBits(registerBits), maxDistance(maxDistance) {
+	if (registerBits < 4 || registerBits > 16) throw std::runtime_error("the number of register bits has to be in [4, 16]");
+}
+
+void HyperANF::setRoundHandler(std::function<void(count, const std::vector<node>&, const std::vector<double>&)> handler) {
+	roundHandler = handler;
+}
+
+count HyperANF::registerBitsFor(count k) {
+	count bits = 4;
+	while (bits < 16 && (count(1) << bits) < k) {
+		++bits;
+	}
+	return bits;
+}
+
+double HyperANF::estimate(const uint8_t* registers) const {
+	const count m = count(1) << registerBits;
+	double alpha;
+	switch (m) {
+		case 16: alpha = 0.673; break;
+		case 32: alpha = 0.697; break;
+		case 64: alpha = 0.709; break;
+		default: alpha = 0.7213 / (1.0 + 1.079 / m);
+	}
+	double sum = 0;
+	count zeros = 0;
+	for (index j = 0; j < m; ++j) {
+		sum += std::ldexp(1.0, -registers[j]);
+		zeros += (registers[j] == 0);
+	}
+	double result = alpha * m * m / sum;
+	// small range correction: count the empty registers instead
+	if (result <= 2.5 * m && zeros > 0) {
+		result = m * std::log((double) m / zeros);
+	}
+	return result;
+}
+
+void HyperANF::run() {
+	const count z = G.upperNodeIdBound();
+	const count m = count(1) << registerBits;
+	const count maxRank = 64 - registerBits + 1;
+	const count threads = omp_get_max_threads();
+
+	// the counter of node v is registers[v*m, (v+1)*m)
+	std::vector<uint8_t> registers(z * m, 0);
+	estimates.assign(z, 0);
+
+	// add every node to its own counter: the first bits of its hash select the register, the position of the
+	// leftmost one in the remaining bits is the rank stored in it
+	const uint64_t seed = Aux::Random::integer();
+	G.parallelForNodes([&](node v) {
+		uint64_t hash = Aux::Random::SplitMix64(seed, v)();
+		uint64_t rest = hash << registerBits;
+		count rank = 1;
+		while (rank < maxRank && !(rest >> 63)) {
+			rest <<= 1;
+			++rank;
+		}
+		registers[v * m + (hash >> (64 - registerBits))] = (uint8_t) rank;
+		estimates[v] = estimate(&registers[v * m]);
+	});
+	double sum = 0;
+	#pragma omp parallel for reduction(+:sum)
+	for (index v = 0; v < z; ++v) {
+		sum += estimates[v];
+	}
+	neighborhoodFunction = {sum};
+
+	// nodes whose counter may change in the current round
+	std::vector<node> active;
+	G.forNodes([&](node v) {
+		if (G.degree(v) > 0) {
+			active.push_back(v);
+		}
+	});
+	std::vector<node> changed;
+	std::vector<uint8_t> marked(z, 0);
+	std::vector<std::vector<node>> localNodes(threads);
+	// the new counters of the changed nodes, in the order of localNodes
+	std::vector<std::vector<uint8_t>> localRegisters(threads);
+
+	for (count t = 1; !active.empty() && (maxDistance == 0 || t <= maxDistance); ++t) {
+		double delta = 0;
+		#pragma omp parallel reduction(+:delta)
+		{
+			index tid = omp_get_thread_num();
+			std::vector<node>& changedNodes = localNodes[tid];
+			std::vector<uint8_t>& changedRegisters = localRegisters[tid];
+			changedNodes.clear();
+			changedRegisters.clear();
+			std::vector<uint8_t> current(m);
+
+			#pragma omp for schedule(guided)
+			for (index i = 0; i < active.size(); ++i) {
+				node v = active[i];
+				const uint8_t* previous = &registers[v * m];
+				std::copy(previous, previous + m, current.begin());
+				G.forNeighborsOf(v, [&](node u) {
+					unite(current.data(), &registers[u * m], m);
+				});
+				if (!std::equal(current.begin(), current.end(), previous)) {
+					changedNodes.push_back(v);
+					changedRegisters.insert(changedRegisters.end(), current.begin(), current.end());
+					double e = estimate(current.data());
+					delta += e - estimates[v];
+					estimates[v] = e;
+				}
+			}
+			// after the implicit barrier all counters of the previous round have been read and may be overwritten
+			for (index i = 0; i < changedNodes.size(); ++i) {
+				std::copy(changedRegisters.begin() + i * m, changedRegisters.begin() + (i + 1) * m, registers.begin() + changedNodes[i] * m);
+			}
+		}
+		concatenate(localNodes, changed);
+		if (changed.empty()) {
+			break;
+		}
+		neighborhoodFunction.push_back(neighborhoodFunction.back() + delta);
+		if (roundHandler) {
+			roundHandler(t, changed, estimates);
+		}
+
+		// only the in-neighbors of changed nodes can change in the next round
+		#pragma omp parallel
+		{
+			std::vector<node>& next = localNodes[omp_get_thread_num()];
+			next.clear();
+			#pragma omp for schedule(guided)
+			for (index i = 0; i < changed.size(); ++i) {
+				G.forInNeighborsOf(changed[i], [&](node v) {
+					uint8_t wasMarked;
+					#pragma omp atomic capture
+					{wasMarked = marked[v]; marked[v] = 1;}
+					if (!wasMarked) {
+						next.push_back(v);
+					}
+				});
+			}
+		}
+		concatenate(localNodes, active);
+		#pragma omp parallel for
+		for (index i = 0; i < active.size(); ++i) {
+			marked[active[i]] = 0;
+		}
+	}
+	hasRun = true;
+}
+
+std::vector<double> HyperANF::getNeighborhoodFunction() const {
+	if(!hasRun) {
+		throw std::runtime_error("Call run()-function first.");
+	}
+	return neighborhoodFunction;
+}
+
+std::vector<double> HyperANF::getReachableNodes() const {
+	if(!hasRun) {
+		throw std::runtime_error("Call run()-function first.");
+	}
+	return estimates;
+}
+
+} /* namespace NetworKit */
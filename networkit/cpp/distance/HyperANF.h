@@ -0,0 +1,84 @@
+/*
+* HyperANF.h
+*
+*  Created on: 18.10.2026
+*/
+
+#ifndef HYPERANF_H_
+#define HYPERANF_H_
+
+#include "../base/Algorithm.h"
+#include "../graph/Graph.h"
+
+#include <cstdint>
+#include <functional>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ */
+class HyperANF : public Algorithm {
+
+public:
+	/**
+	* Approximates the neighborhood function with HyperLogLog counters, following the HyperANF algorithm
+	* presented in the paper "HyperANF: Approximating the Neighbourhood Function of Very Large Graphs on a Budget"[1].
+	* Every node keeps a counter of 2^registerBits one-byte registers that estimates the number of nodes it reaches
+	* within distance t. In round t each counter becomes the register-wise maximum of its own counter and the counters
+	* of its out-neighbors, so that the set union of round t is computed without storing any set.
+	*
+	* All counters are stored in one contiguous array. Only nodes with an out-neighbor whose counter changed in the
+	* previous round are recomputed, and the algorithm stops as soon as no counter changes. The graph may be directed
+	* and disconnected. The relative standard error of a counter is about 1.04 / sqrt(2^registerBits).
+	*
+	* [1] by Boldi, Rosa and Vigna which can be found here: http://vigna.di.unimi.it/ftp/papers/HyperANF.pdf
+	*
+	* @param G the given graph
+	* @param registerBits the logarithm of the number of registers per counter, in [4, 16]; default = 6
+	* @param maxDistance the maximum distance that shall be considered, 0 for no limit; default = 0
+	*/
+	HyperANF(const Graph& G, const count registerBits=6, const count maxDistance=0);
+
+	void run() override;
+
+	/**
+	 * Sets a function that is called after every round t >= 1 with t, the nodes whose counter changed in the
+	 * round and the current estimates of all nodes. The function is called from a sequential context.
+	 */
+	void setRoundHandler(std::function<void(count, const std::vector<node>&, const std::vector<double>&)> handler);
+
+	/**
+	 * Returns the approximated neighborhood function of the graph. The t-th element is the estimated number of
+	 * node pairs (u,v) such that v is reachable from u within distance t, including the pairs (u,u), up to the
+	 * last round in which a counter changed.
+	 * @return the approximated neighborhood function of the graph
+	 */
+	std::vector<double> getNeighborhoodFunction() const;
+
+	/**
+	 * Returns the estimated number of nodes reachable from every node, including the node itself.
+	 * @return the estimate of every node
+	 */
+	std::vector<double> getReachableNodes() const;
+
+	/**
+	 * Returns the number of register bits such that a counter has at least @a k registers, clamped to [4, 16].
+	 * Used to map the number of parallel approximations of the Flajolet-Martin based interfaces to HyperLogLog counters.
+	 */
+	static count registerBitsFor(count k);
+
+private:
+	const Graph& G;
+	const count registerBits;
+	const count maxDistance;
+	std::function<void(count, const std::vector<node>&, const std::vector<double>&)> roundHandler;
+	std::vector<double> neighborhoodFunction;
+	std::vector<double> estimates;
+
+	double estimate(const uint8_t* registers) const;
+};
+
+} /* namespace NetworKit */
+
+#endif /* HYPERANF_H_ */
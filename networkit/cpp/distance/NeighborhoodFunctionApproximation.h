@@ -23,13 +23,15 @@ public:
 	* Computes an approximation of the neighborhood function.
 	* The neighborhood function N of a graph G for a given distance t is defined
 	* as the number of node pairs (u,v) that can be reached within distance t.
-	* Implementation after the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
+	* The approximation is computed by HyperANF, i.e. with HyperLogLog counters instead of the Flajolet-Martin
+	* bitmasks of the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1].
+	* The graph may be disconnected.
 	*
 	* [1] by Palmer, Gibbons and Faloutsos which can be found here: http://www.cs.cmu.edu/~christos/PUBLICATIONS/kdd02-anf.pdf
 	*
 	* @param G the given graph
-	* @param k the number of parallel approximations to get a more robust result; default = 64
-	* @param r the amount of bits that are added to the length of the bitmask to improve the accuracy; default = 7
+	* @param k the number of registers per counter, rounded up to a power of two in [16, 65536], to get a more robust result; default = 64
+	* @param r ignored, HyperLogLog registers need no additional bits; kept for compatibility
 	*/
 	NeighborhoodFunctionApproximation(const Graph& G, const count k=64, const count r=7);
 
@@ -9,6 +9,7 @@
 #include "../../graph/Graph.h"
 #include "../../io/METISGraphReader.h"
 #include "../../centrality/SpanningEdgeCentrality.h"
+#include "../EffectiveResistanceSketch.h"
 #include <math.h>
 #include <fstream>
 #include <iomanip>
@@ -155,4 +156,72 @@ TEST_F(CommuteTimeDistanceGTest, testECTDSingleSource) {
 	}
 }
 
+
+TEST_F(CommuteTimeDistanceGTest, testEffectiveResistanceSketch) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/karate.graph");
+	G.indexEdges();
+	count m = G.numberOfEdges();
+
+	CommuteTimeDistance exact(G);
+	exact.run();
+	SpanningEdgeCentrality exactSpanning(G);
+	exactSpanning.run();
+
+	EffectiveResistanceSketch sketch(G, 0.1);
+	sketch.run();
+	EXPECT_EQ((count) std::ceil(std::log2(G.numberOfNodes()) / 0.01), sketch.getSketchDimension());
+
+	std::vector<std::pair<node, node>> pairs;
+	double error = 0.0;
+	G.forNodePairs([&](node u, node v) {
+		double resistance = exact.distance(u, v) * exact.distance(u, v) / m;
+		error += fabs(sketch.effectiveResistance(u, v) - resistance) / resistance;
+		pairs.push_back({u, v});
+	});
+	error /= pairs.size();
+	EXPECT_LT(error, 0.1);
+
+	std::vector<double> batch = sketch.effectiveResistances(pairs);
+	for (index i = 0; i < pairs.size(); ++i) {
+		EXPECT_EQ(sketch.effectiveResistance(pairs[i].first, pairs[i].second), batch[i]);
+	}
+	EXPECT_EQ(0.0, sketch.effectiveResistance(3, 3));
+
+	std::vector<double> scores = sketch.edgeScores();
+	G.forEdges([&](node u, node v, edgeid e) {
+		EXPECT_NEAR(exactSpanning.score(e), scores[e], 0.3 * exactSpanning.score(e));
+	});
+}
+
+TEST_F(CommuteTimeDistanceGTest, testEffectiveResistanceSketchWeighted) {
+	// weighted path 0 - 1 - 2 and a pendant triangle 2 - 3 - 4
+	Graph G(5, true);
+	G.addEdge(0, 1, 2.0);
+	G.addEdge(1, 2, 4.0);
+	G.addEdge(2, 3, 1.0);
+	G.addEdge(3, 4, 1.0);
+	G.addEdge(2, 4, 1.0);
+	G.indexEdges();
+
+	EffectiveResistanceSketch sketch(G, 0.05);
+	sketch.run();
+
+	EXPECT_NEAR(0.5, sketch.effectiveResistance(0, 1), 0.1);
+	EXPECT_NEAR(0.75, sketch.effectiveResistance(0, 2), 0.15);
+	EXPECT_NEAR(2.0 / 3.0, sketch.effectiveResistance(2, 3), 0.13);
+
+	// weight times resistance of a bridge is 1
+	std::vector<double> scores = sketch.edgeScores();
+	EXPECT_NEAR(1.0, scores[G.edgeId(0, 1)], 0.2);
+	EXPECT_NEAR(1.0, scores[G.edgeId(1, 2)], 0.2);
+
+	Graph unindexed(3);
+	unindexed.addEdge(0, 1);
+	EffectiveResistanceSketch noIds(unindexed);
+	noIds.run();
+	EXPECT_THROW(noIds.edgeScores(), std::runtime_error);
+	EXPECT_THROW(EffectiveResistanceSketch(G, 0.0), std::runtime_error);
+}
+
 } /* namespace NetworKit */
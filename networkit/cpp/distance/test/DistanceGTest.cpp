@@ -9,16 +9,21 @@
 #include "DistanceGTest.h"
 
 #include "../Diameter.h"
+#include "../EccentricityBounding.h"
+#include "../Eccentricity.h"
 #include "../EffectiveDiameter.h"
 #include "../EffectiveDiameterApproximation.h"
 #include "../HopPlotApproximation.h"
+#include "../HyperANF.h"
 #include "../NeighborhoodFunction.h"
 #include "../NeighborhoodFunctionApproximation.h"
 #include "../NeighborhoodFunctionHeuristic.h"
 
 #include "../../generators/DorogovtsevMendesGenerator.h"
 #include "../../generators/ErdosRenyiGenerator.h"
+#include "../../graph/Dijkstra.h"
 #include "../../io/METISGraphReader.h"
+#include "../../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -71,6 +76,140 @@ TEST_F(DistanceGTest, testEstimatedDiameterRange) {
 		EXPECT_LE(testInstance.second, range.second);
 	}
 }
+namespace {
+
+std::vector<edgeweight> eccentricitiesByDijkstra(const Graph& G) {
+	std::vector<edgeweight> result(G.upperNodeIdBound(), 0);
+	G.forNodes([&](node u) {
+		Dijkstra dijkstra(G, u, false);
+		dijkstra.run();
+		for (edgeweight d : dijkstra.getDistances()) {
+			if (d != std::numeric_limits<edgeweight>::max()) {
+				result[u] = std::max(result[u], d);
+			}
+		}
+	});
+	return result;
+}
+
+void expectEccentricities(const Graph& G) {
+	std::vector<edgeweight> expected = eccentricitiesByDijkstra(G);
+	edgeweight diameter = *std::max_element(expected.begin(), expected.end());
+
+	EccentricityBounding all(G, true);
+	all.run();
+	std::vector<edgeweight> eccentricities = all.getEccentricities();
+	G.forNodes([&](node u) {
+		EXPECT_NEAR(expected[u], eccentricities[u], 1e-9);
+	});
+	EXPECT_NEAR(diameter, all.getDiameter().first, 1e-9);
+
+	EccentricityBounding exact(G);
+	exact.run();
+	EXPECT_NEAR(diameter, exact.getDiameter().first, 1e-9);
+	EXPECT_NEAR(diameter, exact.getDiameter().second, 1e-9);
+	EXPECT_LE(exact.numberOfSearches(), all.numberOfSearches());
+	std::vector<edgeweight> lower = exact.getLowerBounds();
+	std::vector<edgeweight> upper = exact.getUpperBounds();
+	G.forNodes([&](node u) {
+		EXPECT_LE(lower[u], expected[u] + 1e-9);
+		EXPECT_GE(upper[u], expected[u] - 1e-9);
+	});
+
+	EccentricityBounding range(G, false, 0.5);
+	range.run();
+	EXPECT_LE(range.getDiameter().first, diameter + 1e-9);
+	EXPECT_GE(range.getDiameter().second, diameter - 1e-9);
+	EXPECT_LE(range.getDiameter().second, 1.5 * range.getDiameter().first + 1e-9);
+}
+
+} /* anonymous namespace */
+
+TEST_F(DistanceGTest, testEccentricityBoundingUndirected) {
+	Aux::Random::setSeed(42, false);
+	// sparse enough to be disconnected, with some isolated nodes
+	ErdosRenyiGenerator generator(300, 0.006);
+	Graph G = generator.generate();
+	expectEccentricities(G);
+
+	Graph W(G, true, false);
+	W.forEdges([&](node u, node v) {
+		W.setWeight(u, v, Aux::Random::real(0.5, 3.0));
+	});
+	expectEccentricities(W);
+
+	std::vector<edgeweight> values = Eccentricity::getValues(G);
+	G.forNodes([&](node u) {
+		EXPECT_EQ(Eccentricity::getValue(G, u).second, values[u]);
+	});
+}
+
+TEST_F(DistanceGTest, testEccentricityBoundingManyComponents) {
+	// many small components next to a large one
+	count paths = 2000;
+	Graph G(3 * paths + 100);
+	for (node p = 0; p < paths; ++p) {
+		G.addEdge(3 * p, 3 * p + 1);
+		if (p % 2 == 0) {
+			G.addEdge(3 * p + 1, 3 * p + 2);
+		}
+	}
+	for (node u = 3 * paths; u + 1 < G.upperNodeIdBound(); ++u) {
+		G.addEdge(u, u + 1);
+	}
+
+	EccentricityBounding all(G, true);
+	all.run();
+	std::vector<edgeweight> eccentricities = all.getEccentricities();
+	for (node p = 0; p < paths; ++p) {
+		EXPECT_EQ(p % 2 == 0 ? 2.0 : 1.0, eccentricities[3 * p]);
+		EXPECT_EQ(1.0, eccentricities[3 * p + 1]);
+	}
+	EXPECT_EQ(99.0, eccentricities[3 * paths]);
+	EXPECT_EQ(99.0, all.getDiameter().first);
+
+	EccentricityBounding exact(G);
+	exact.run();
+	EXPECT_EQ(std::make_pair(99.0, 99.0), exact.getDiameter());
+	// the small components cannot raise the diameter
+	EXPECT_LT(exact.numberOfSearches(), paths);
+}
+
+TEST_F(DistanceGTest, testEccentricityBoundingDirected) {
+	Aux::Random::setSeed(42, false);
+	count n = 200;
+	Graph G(n, true, true);
+	// a cycle makes the graph strongly connected
+	for (node u = 0; u < n; ++u) {
+		G.addEdge(u, (u + 1) % n, Aux::Random::real(0.5, 3.0));
+	}
+	for (index i = 0; i < 2 * n; ++i) {
+		node u = Aux::Random::integer(n - 1);
+		node v = Aux::Random::integer(n - 1);
+		if (u != v && !G.hasEdge(u, v)) {
+			G.addEdge(u, v, Aux::Random::real(0.5, 3.0));
+		}
+	}
+	expectEccentricities(G);
+	expectEccentricities(Graph(G, false, true));
+
+	Diameter diam(G, DiameterAlgo::exact);
+	diam.run();
+	std::vector<edgeweight> expected = eccentricitiesByDijkstra(G);
+	EXPECT_EQ((count) *std::max_element(expected.begin(), expected.end()), diam.getDiameter().first);
+
+	// node 0 becomes unreachable
+	std::vector<node> predecessors;
+	G.forInNeighborsOf(0, [&](node u) {
+		predecessors.push_back(u);
+	});
+	for (node u : predecessors) {
+		G.removeEdge(u, 0);
+	}
+	EccentricityBounding bounding(G);
+	EXPECT_THROW(bounding.run(), std::runtime_error);
+}
+
 TEST_F(DistanceGTest, testPedanticDiameterErdos) {
 	count n = 5000;
 	ErdosRenyiGenerator gen(n,0.001);
@@ -267,6 +406,83 @@ TEST_F(DistanceGTest, testNeighborhoodFunctionApproximation) {
 	EXPECT_EQ(exact.size(), approximated.size());
 }
 
+TEST_F(DistanceGTest, testHyperANF) {
+	Aux::Random::setSeed(42, false);
+	METISGraphReader reader;
+	Graph G = reader.read("input/lesmis.graph").toUnweighted();
+	count n = G.numberOfNodes();
+	NeighborhoodFunction nf(G);
+	nf.run();
+	auto exact = nf.getNeighborhoodFunction();
+	HyperANF anf(G, 10);
+	anf.run();
+	auto approximated = anf.getNeighborhoodFunction();
+	ASSERT_LE(approximated.size(), exact.size() + 1);
+	EXPECT_NEAR(n, approximated[0], 0.1 * n);
+	for (index t = 1; t < approximated.size(); ++t) {
+		EXPECT_NEAR(exact[t - 1] + n, approximated[t], 0.1 * (exact[t - 1] + n));
+	}
+	EXPECT_THROW(HyperANF(G, 3), std::runtime_error);
+	EXPECT_THROW(HyperANF(G, 17), std::runtime_error);
+
+	HyperANF bounded(G, 10, 2);
+	bounded.run();
+	EXPECT_EQ(3u, bounded.getNeighborhoodFunction().size());
+}
+
+TEST_F(DistanceGTest, testHyperANFDisconnected) {
+	Aux::Random::setSeed(42, false);
+	// a path of 30 nodes, a star with 20 leaves and an isolated node
+	Graph G(52);
+	for (node u = 0; u + 1 < 30; ++u) {
+		G.addEdge(u, u + 1);
+	}
+	for (node u = 31; u < 51; ++u) {
+		G.addEdge(30, u);
+	}
+	HyperANF anf(G, 10);
+	count rounds = 0;
+	anf.setRoundHandler([&](count t, const std::vector<node>& changed, const std::vector<double>&) {
+		EXPECT_EQ(++rounds, t);
+		EXPECT_FALSE(changed.empty());
+	});
+	anf.run();
+	auto approximated = anf.getNeighborhoodFunction();
+	EXPECT_EQ(rounds + 1, approximated.size());
+	EXPECT_LE(approximated.size(), 30u);
+	EXPECT_NEAR(30 * 30 + 21 * 21 + 1, approximated.back(), 0.1 * (30 * 30 + 21 * 21 + 1));
+	auto reachable = anf.getReachableNodes();
+	EXPECT_NEAR(1.0, reachable[51], 0.1);
+	for (node u = 30; u < 51; ++u) {
+		EXPECT_NEAR(21.0, reachable[u], 2.1);
+	}
+
+	// the wrappers accept disconnected graphs
+	HopPlotApproximation hp(G);
+	hp.run();
+	auto hopPlot = hp.getHopPlot();
+	EXPECT_NEAR(1.0, hopPlot.rbegin()->second, 0.2);
+	EffectiveDiameterApproximation aef(G);
+	aef.run();
+	EXPECT_LE(aef.getEffectiveDiameter(), 29.0);
+	EXPECT_GT(aef.getEffectiveDiameter(), 0.0);
+}
+
+TEST_F(DistanceGTest, testHyperANFDirected) {
+	Aux::Random::setSeed(42, false);
+	// from node u of the directed path, the nodes u, ..., 49 are reachable
+	Graph G(50, false, true);
+	for (node u = 0; u + 1 < 50; ++u) {
+		G.addEdge(u, u + 1);
+	}
+	HyperANF anf(G, 10);
+	anf.run();
+	auto reachable = anf.getReachableNodes();
+	for (node u = 0; u < 50; ++u) {
+		EXPECT_NEAR(50.0 - u, reachable[u], 0.1 * (50.0 - u));
+	}
+}
+
 TEST_F(DistanceGTest, testNeighborhoodFunctionHeuristic) {
 	METISGraphReader reader;
 	Graph G = reader.read("input/lesmis.graph").toUnweighted();
@@ -0,0 +1,265 @@
+/*
+ * BinaryEventStream.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "BinaryEventStream.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace NetworKit {
+
+namespace {
+
+const char cookie[8] = {'N', 'K', 'E', 'V', 'B', '0', '0', '1'};
+
+const unsigned typeBits = 3;
+
+/** Fixed-size header written in front of every block. */
+struct BlockHeader {
+	uint64_t numEvents;
+	uint64_t timeStepsBefore;	// number of TIME_STEP events in all previous blocks
+	uint8_t uBits;
+	uint8_t vBits;
+	uint8_t hasWeights;
+	uint8_t padding[5];
+	uint64_t numWords;
+};
+
+inline bool hasU(GraphEvent::Type type) {
+	return type != GraphEvent::TIME_STEP;
+}
+
+inline bool hasV(GraphEvent::Type type) {
+	return type >= GraphEvent::EDGE_ADDITION && type <= GraphEvent::EDGE_WEIGHT_INCREMENT;
+}
+
+inline uint64_t zigzag(uint64_t x, uint64_t base) {
+	int64_t d = (int64_t) (x - base);
+	return ((uint64_t) d << 1) ^ (uint64_t) (d >> 63);
+}
+
+inline uint64_t unzigzag(uint64_t z, uint64_t base) {
+	return base + ((z >> 1) ^ (~(z & 1) + 1));
+}
+
+inline unsigned bitWidth(uint64_t x) {
+	unsigned w = 0;
+	while (x) {
+		++w;
+		x >>= 1;
+	}
+	return w;
+}
+
+inline uint64_t lowMask(unsigned bits) {
+	return bits == 64 ? ~(uint64_t) 0 : (((uint64_t) 1 << bits) - 1);
+}
+
+inline void putBits(std::vector<uint64_t>& words, uint64_t pos, unsigned bits, uint64_t value) {
+	if (bits == 0) return;
+	uint64_t word = pos >> 6;
+	unsigned offset = pos & 63;
+	words[word] |= value << offset;
+	if (offset + bits > 64) {
+		words[word + 1] |= value >> (64 - offset);
+	}
+}
+
+inline uint64_t getBits(const std::vector<uint64_t>& words, uint64_t pos, unsigned bits) {
+	if (bits == 0) return 0;
+	uint64_t word = pos >> 6;
+	unsigned offset = pos & 63;
+	uint64_t value = words[word] >> offset;
+	if (offset + bits > 64) {
+		value |= words[word + 1] << (64 - offset);
+	}
+	return value & lowMask(bits);
+}
+
+} /* anonymous namespace */
+
+
+BinaryEventStreamWriter::BinaryEventStreamWriter(std::string path, count blockSize) : out(path, std::ios::binary | std::ios::trunc), blockSize(blockSize), timeSteps(0) {
+	if (!out.is_open()) {
+		throw std::runtime_error("binary event stream file could not be opened: " + path);
+	}
+	if (blockSize == 0) {
+		throw std::runtime_error("block size must be positive");
+	}
+	out.write(cookie, sizeof(cookie));
+	pending.reserve(blockSize);
+}
+
+BinaryEventStreamWriter::~BinaryEventStreamWriter() {
+	if (out.is_open()) {
+		flush();
+		out.close();
+	}
+}
+
+void BinaryEventStreamWriter::write(const std::vector<GraphEvent>& stream) {
+	for (const GraphEvent& ev : stream) {
+		write(ev);
+	}
+}
+
+void BinaryEventStreamWriter::write(const GraphEvent& event) {
+	if (!out.is_open()) {
+		throw std::runtime_error("binary event stream has already been closed");
+	}
+	if (event.type > GraphEvent::TIME_STEP) {
+		throw std::runtime_error("unknown event type");
+	}
+	pending.push_back(event);
+	if (pending.size() == blockSize) {
+		flush();
+	}
+}
+
+void BinaryEventStreamWriter::close() {
+	if (out.is_open()) {
+		flush();
+		out.close();
+		if (out.fail()) {
+			throw std::runtime_error("error while writing binary event stream");
+		}
+	}
+}
+
+void BinaryEventStreamWriter::flush() {
+	if (pending.empty()) return;
+
+	// first pass: widths of the delta-encoded fields
+	uint64_t maxU = 0, maxV = 0;
+	bool weighted = false;
+	uint64_t prevU = 0;
+	uint64_t steps = 0;
+	for (const GraphEvent& ev : pending) {
+		if (hasU(ev.type)) {
+			maxU |= zigzag(ev.u, prevU);
+			prevU = ev.u;
+		} else {
+			++steps;
+		}
+		if (hasV(ev.type)) {
+			maxV |= zigzag(ev.v, ev.u);
+		}
+		weighted |= (ev.w != 1.0);
+	}
+
+	BlockHeader header = {};
+	header.numEvents = pending.size();
+	header.timeStepsBefore = timeSteps;
+	header.uBits = bitWidth(maxU);
+	header.vBits = bitWidth(maxV);
+	header.hasWeights = weighted;
+	uint64_t recordBits = typeBits + header.uBits + header.vBits;
+	header.numWords = (recordBits * header.numEvents + 63) / 64;
+
+	// second pass: pack records
+	words.assign(header.numWords, 0);
+	uint64_t pos = 0;
+	prevU = 0;
+	for (const GraphEvent& ev : pending) {
+		putBits(words, pos, typeBits, ev.type);
+		if (hasU(ev.type)) {
+			putBits(words, pos + typeBits, header.uBits, zigzag(ev.u, prevU));
+			prevU = ev.u;
+		}
+		if (hasV(ev.type)) {
+			putBits(words, pos + typeBits + header.uBits, header.vBits, zigzag(ev.v, ev.u));
+		}
+		pos += recordBits;
+	}
+
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	out.write(reinterpret_cast<const char*>(words.data()), words.size() * sizeof(uint64_t));
+	if (weighted) {
+		for (const GraphEvent& ev : pending) {
+			out.write(reinterpret_cast<const char*>(&ev.w), sizeof(edgeweight));
+		}
+	}
+
+	timeSteps += steps;
+	pending.clear();
+}
+
+
+BinaryEventStreamReader::BinaryEventStreamReader(std::string path) : in(path, std::ios::binary), timeSteps(0) {
+	if (!in.is_open()) {
+		throw std::runtime_error("binary event stream file could not be opened: " + path);
+	}
+	char found[sizeof(cookie)];
+	in.read(found, sizeof(found));
+	if (!in || !std::equal(found, found + sizeof(found), cookie)) {
+		throw std::runtime_error("not a binary event stream: " + path);
+	}
+}
+
+bool BinaryEventStreamReader::next(std::vector<GraphEvent>& batch) {
+	batch.clear();
+	BlockHeader header;
+	in.read(reinterpret_cast<char*>(&header), sizeof(header));
+	if (in.gcount() == 0 && in.eof()) {
+		return false;
+	}
+	uint64_t recordBits = typeBits + header.uBits + header.vBits;
+	if (!in || header.uBits > 64 || header.vBits > 64 || header.numWords != (recordBits * header.numEvents + 63) / 64) {
+		throw std::runtime_error("corrupt block in binary event stream");
+	}
+
+	words.resize(header.numWords);
+	in.read(reinterpret_cast<char*>(words.data()), words.size() * sizeof(uint64_t));
+	if (header.hasWeights) {
+		weights.resize(header.numEvents);
+		in.read(reinterpret_cast<char*>(weights.data()), weights.size() * sizeof(edgeweight));
+	}
+	if (!in) {
+		throw std::runtime_error("unexpected end of binary event stream");
+	}
+
+	batch.resize(header.numEvents);
+	timeSteps = header.timeStepsBefore;
+	uint64_t pos = 0;
+	uint64_t prevU = 0;
+	for (uint64_t i = 0; i < header.numEvents; ++i) {
+		GraphEvent& ev = batch[i];
+		uint64_t type = getBits(words, pos, typeBits);
+		if (type > GraphEvent::TIME_STEP) {
+			throw std::runtime_error("unknown event type in binary event stream");
+		}
+		ev.type = (GraphEvent::Type) type;
+		ev.u = none;
+		ev.v = none;
+		if (hasU(ev.type)) {
+			ev.u = unzigzag(getBits(words, pos + typeBits, header.uBits), prevU);
+			prevU = ev.u;
+		} else {
+			++timeSteps;
+		}
+		if (hasV(ev.type)) {
+			ev.v = unzigzag(getBits(words, pos + typeBits + header.uBits, header.vBits), ev.u);
+		}
+		ev.w = header.hasWeights ? weights[i] : 1.0;
+		pos += recordBits;
+	}
+	return true;
+}
+
+std::vector<GraphEvent> BinaryEventStreamReader::getStream() {
+	std::vector<GraphEvent> stream;
+	std::vector<GraphEvent> batch;
+	while (next(batch)) {
+		stream.insert(stream.end(), batch.begin(), batch.end());
+	}
+	return stream;
+}
+
+uint64_t BinaryEventStreamReader::getTimeSteps() const {
+	return timeSteps;
+}
+
+} /* namespace NetworKit */
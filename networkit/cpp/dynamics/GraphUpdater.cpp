@@ -14,8 +14,38 @@ GraphUpdater::GraphUpdater(Graph& G) : G(G) {
 }
 
 void GraphUpdater::update(std::vector<GraphEvent>& stream) {
+	// consecutive edge additions and consecutive edge removals are applied as one batch
+	std::vector<WeightedEdge> insertions;
+	std::vector<Edge> deletions;
+	auto applyBatch = [&]() {
+		if (insertions.size() + deletions.size() > 1) {
+			G.applyEdgeBatch(insertions, deletions);
+		} else if (insertions.size() == 1) {
+			G.addEdge(insertions[0].u, insertions[0].v, insertions[0].weight);
+		} else if (deletions.size() == 1) {
+			G.removeEdge(deletions[0].u, deletions[0].v);
+		}
+		insertions.clear();
+		deletions.clear();
+	};
+
 	for (GraphEvent ev : stream) {
 		TRACE("event: " , ev.toString());
+		if (ev.type == GraphEvent::EDGE_ADDITION) {
+			if (!deletions.empty()) {
+				applyBatch();
+			}
+			insertions.emplace_back(ev.u, ev.v, ev.w);
+			continue;
+		} else if (ev.type == GraphEvent::EDGE_REMOVAL) {
+			if (!insertions.empty()) {
+				applyBatch();
+			}
+			deletions.emplace_back(ev.u, ev.v);
+			continue;
+		}
+		applyBatch();
+
 		switch (ev.type) {
 			case GraphEvent::NODE_ADDITION : {
 				G.addNode();
@@ -29,14 +59,6 @@ void GraphUpdater::update(std::vector<GraphEvent>& stream) {
 				G.restoreNode(ev.u);
 				break;
 			}
-			case GraphEvent::EDGE_ADDITION : {
-				G.addEdge(ev.u, ev.v, ev.w);
-				break;
-			}
-			case GraphEvent::EDGE_REMOVAL : {
-				G.removeEdge(ev.u, ev.v);
-				break;
-			}
 			case GraphEvent::EDGE_WEIGHT_UPDATE : {
 				G.setWeight(ev.u, ev.v, ev.w);
 				break;
@@ -54,6 +76,7 @@ void GraphUpdater::update(std::vector<GraphEvent>& stream) {
 			}
 		}
 	}
+	applyBatch();
 	// record graph size
 	size.push_back(std::make_pair(G.numberOfNodes(), G.numberOfEdges()));
 }
@@ -11,6 +11,8 @@
 #include "../../auxiliary/Log.h"
 #include "../GraphEvent.h"
 #include "../GraphUpdater.h"
+#include "../BinaryEventStream.h"
+#include "../../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -51,4 +53,62 @@ TEST_F(DynamicsGTest, testGraphEventIncrement) {
 
 }
 
+TEST_F(DynamicsGTest, testBinaryEventStream) {
+	std::string path = "output/events.nkev";
+	count n = 1000;
+	std::vector<GraphEvent> stream;
+	for (node u = 0; u < n; ++u) {
+		stream.push_back(GraphEvent(GraphEvent::NODE_ADDITION, u));
+	}
+	stream.push_back(GraphEvent(GraphEvent::TIME_STEP));
+	for (index i = 0; i < 5000; ++i) {
+		node u = Aux::Random::integer(n - 1);
+		node v = Aux::Random::integer(n - 1);
+		stream.push_back(GraphEvent(GraphEvent::EDGE_ADDITION, u, v, (i % 7 == 0) ? Aux::Random::real() : 1.0));
+		if (i % 100 == 0) {
+			stream.push_back(GraphEvent(GraphEvent::EDGE_REMOVAL, u, v));
+			stream.push_back(GraphEvent(GraphEvent::TIME_STEP));
+		}
+	}
+	stream.push_back(GraphEvent(GraphEvent::NODE_REMOVAL, 0));
+	stream.push_back(GraphEvent(GraphEvent::NODE_RESTORATION, 0));
+	stream.push_back(GraphEvent(GraphEvent::EDGE_WEIGHT_UPDATE, n - 1, 0, 0.5));
+	stream.push_back(GraphEvent(GraphEvent::EDGE_WEIGHT_INCREMENT, 0, n - 1, -2.0));
+	stream.push_back(GraphEvent(GraphEvent::NODE_ADDITION, none));
+
+	{
+		BinaryEventStreamWriter writer(path, 333);
+		writer.write(stream);
+		writer.close();
+		EXPECT_THROW(writer.write(stream.front()), std::runtime_error);
+	}
+
+	BinaryEventStreamReader reader(path);
+	std::vector<GraphEvent> batch;
+	index i = 0;
+	count steps = 0;
+	while (reader.next(batch)) {
+		EXPECT_LE(batch.size(), 333u);
+		for (const GraphEvent& ev : batch) {
+			ASSERT_LT(i, stream.size());
+			EXPECT_EQ(stream[i].type, ev.type);
+			EXPECT_TRUE(GraphEvent::equal(stream[i], ev)) << "event " << i;
+			steps += (ev.type == GraphEvent::TIME_STEP);
+			++i;
+		}
+		EXPECT_EQ(steps, reader.getTimeSteps());
+	}
+	EXPECT_EQ(stream.size(), i);
+	EXPECT_FALSE(reader.next(batch));
+
+	std::vector<GraphEvent> all = BinaryEventStreamReader(path).getStream();
+	ASSERT_EQ(stream.size(), all.size());
+
+	// the binary log is considerably smaller than the in-memory events
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	EXPECT_LT((count) file.tellg(), stream.size() * sizeof(GraphEvent) / 2);
+
+	EXPECT_THROW(BinaryEventStreamReader("input/example2.dgs"), std::runtime_error);
+}
+
 } /* namespace NetworKit */
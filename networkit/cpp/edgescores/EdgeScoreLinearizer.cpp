@@ -33,8 +33,9 @@ void EdgeScoreLinearizer::run() {
 		typedef std::tuple<edgeweight, index, edgeid> edgeTuple;
 		std::vector<edgeTuple> sorted(G.upperEdgeIdBound(), std::make_tuple(std::numeric_limits<edgeweight>::max(), std::numeric_limits<index>::max(), none));
 
+		const uint64_t seed = Aux::Random::integer();
 		G.parallelForEdges([&](node u, node v, edgeid eid) {
-			sorted[eid] = std::make_tuple(attribute[eid], Aux::Random::integer(), eid);
+			sorted[eid] = std::make_tuple(attribute[eid], Aux::Random::SplitMix64(seed, eid)(), eid);
 		});
 
 		if (inverse) {
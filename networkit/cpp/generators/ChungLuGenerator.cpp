@@ -14,13 +14,17 @@
 
 namespace NetworKit {
 
-ChungLuGenerator::ChungLuGenerator(const std::vector< NetworKit::count > &degreeSequence) :
-		StaticDegreeSequenceGenerator(degreeSequence) {
-	sum_deg = std::accumulate(seq.begin(), seq.end(), 0);
+ChungLuGenerator::ChungLuGenerator(const std::vector< NetworKit::count > &degreeSequence, bool parallel) :
+		StaticDegreeSequenceGenerator(degreeSequence), parallel(parallel) {
+	sum_deg = std::accumulate(seq.begin(), seq.end(), (count) 0);
 	n = (count) seq.size();
 }
 
 	Graph ChungLuGenerator::generate() {
+		if (parallel) {
+			return generateParallel();
+		}
+
 		GraphBuilder gB(n);
 
 		/* We need a sorted list in descending order for this algorithm */
@@ -56,4 +60,66 @@ ChungLuGenerator::ChungLuGenerator(const std::vector< NetworKit::count > &degree
 		return gB.toGraph(true,true);
 	}
 
+	Graph ChungLuGenerator::generateParallel() {
+		GraphBuilder gB(n);
+		if (n < 2 || sum_deg == 0) {
+			return gB.toGraph(true, true);
+		}
+
+		/* We need a sorted list in descending order for this algorithm */
+		Aux::Parallel::sort(seq.begin(), seq.end(), [](count a, count b){ return a > b;});
+
+		const uint64_t seed = Aux::Random::integer();
+
+		/* Row u creates about seq[u] * (seq[u+1] + ... + seq[n-1]) / sum_deg edges.
+		 * Cut the rows into blocks of roughly equal expected work. The blocks only depend
+		 * on the degree sequence, so each block always draws from the same random stream. */
+		const double workPerBlock = 1 << 16;
+		std::vector<node> blockBegin{0};
+		double remainingVolume = (double) sum_deg;
+		double work = 0.0;
+		for (node u = 0; u < n; ++u) {
+			remainingVolume -= (double) seq[u];
+			work += 1.0 + ((double) seq[u]) * remainingVolume / sum_deg;
+			if (work >= workPerBlock && u + 1 < n) {
+				blockBegin.push_back(u + 1);
+				work = 0.0;
+			}
+		}
+		blockBegin.push_back(n);
+		const count nBlocks = blockBegin.size() - 1;
+
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (index b = 0; b < nBlocks; ++b) {
+			Aux::Random::SplitMix64 urng(seed, b);
+
+			for (node u = blockBegin[b]; u < blockBegin[b + 1]; ++u) {
+				node v = u + 1;
+				if (v == n) {
+					break;
+				}
+				double p = std::min(((double) seq[u]) * ((double) seq[v]) / sum_deg, 1.0);
+
+				while (v < n && p > 0) {
+					if (p != 1.0) {
+						/* 1 - urng.real() lies in (0, 1] */
+						double skip = std::floor(log(1.0 - urng.real()) / log(1 - p));
+						if (skip >= (double) (n - v)) {
+							break;
+						}
+						v = v + (node) skip;
+					}
+					double q = std::min(((double) seq[u]) * ((double) seq[v]) / sum_deg, 1.0);
+					if (urng.real() < q / p) {
+						gB.addHalfOutEdge(u, v);
+					}
+					p = q;
+					v++;
+				}
+			}
+		}
+
+		return gB.toGraph(true, true);
+	}
+
 } /* namespace NetworKit */
@@ -34,9 +34,22 @@ class ChungLuGenerator: public StaticDegreeSequenceGenerator {
 protected:
 	count sum_deg;
 	count n;
+	bool parallel;
+
+	/**
+	 * Parallel variant of generate(), see constructor.
+	 */
+	Graph generateParallel();
 
 public:
-	ChungLuGenerator(const std::vector<count>& degreeSequence);
+	/**
+	 * @param degreeSequence Expected degree sequence.
+	 * @param parallel If true, the degree-sorted nodes are split into blocks of roughly
+	 * equal expected work that are processed in parallel. Each block uses its own random
+	 * stream derived from a single seed drawn from Aux::Random, so the resulting graph
+	 * does not depend on the number of threads.
+	 */
+	ChungLuGenerator(const std::vector<count>& degreeSequence, bool parallel = false);
 
 	/**
 	 * Generates graph with expected degree sequence seq.
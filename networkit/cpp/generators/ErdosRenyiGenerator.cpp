@@ -5,13 +5,16 @@
  *      Author: Henning
  */
 
+#include <algorithm>
+
 #include "ErdosRenyiGenerator.h"
+#include "../graph/GraphBuilder.h"
 #include "../auxiliary/Random.h"
 #include "../auxiliary/SignalHandling.h"
 
 namespace NetworKit {
 
-ErdosRenyiGenerator::ErdosRenyiGenerator(count nNodes, double prob, bool directed): n(nNodes), p(prob), directed(directed) {
+ErdosRenyiGenerator::ErdosRenyiGenerator(count nNodes, double prob, bool directed, bool parallel): n(nNodes), p(prob), directed(directed), parallel(parallel) {
 
 }
 
@@ -24,6 +27,10 @@ static inline count get_next_edge_distance(const double log_cp) {
 }
 
 Graph ErdosRenyiGenerator::generate() {
+	if (parallel) {
+		return generateParallel();
+	}
+
 	Aux::SignalHandler handler;
 	Graph G(n, false, directed);
 	const double log_cp = log(1.0 - p); // log of counter probability
@@ -53,4 +60,75 @@ Graph ErdosRenyiGenerator::generate() {
 	return G;
 }
 
+Graph ErdosRenyiGenerator::generateParallel() {
+	GraphBuilder builder(n, false, directed);
+	if (n < 2 || p <= 0.0) {
+		return builder.toGraph(true, true);
+	}
+
+	const double log_cp = log(1.0 - p); // log of counter probability
+	const uint64_t seed = Aux::Random::integer();
+
+	// candidate pairs of row u: (u, v) with v < u for undirected, v != u for directed graphs
+	auto rowLength = [&](node u) -> count {
+		return directed ? n - 1 : u;
+	};
+
+	// Split the rows into blocks of roughly equal expected number of edges. The blocks
+	// only depend on n and p, so the random stream of each block is the same no matter
+	// which or how many threads process it.
+	const double edgesPerBlock = 1 << 16;
+	const double pairsPerBlock = std::max(1.0, std::ceil(edgesPerBlock / p));
+	std::vector<node> blockBegin{0};
+	count pairsInBlock = 0;
+	for (node u = 0; u < n; ++u) {
+		pairsInBlock += rowLength(u);
+		if ((double) pairsInBlock >= pairsPerBlock && u + 1 < n) {
+			blockBegin.push_back(u + 1);
+			pairsInBlock = 0;
+		}
+	}
+	blockBegin.push_back(n);
+	const count nBlocks = blockBegin.size() - 1;
+
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index b = 0; b < nBlocks; ++b) {
+		Aux::Random::SplitMix64 urng(seed, b);
+
+		count blockPairs = 0;
+		for (node u = blockBegin[b]; u < blockBegin[b + 1]; ++u) {
+			blockPairs += rowLength(u);
+		}
+
+		node curr = blockBegin[b];
+		count rowOffset = 0; // position of the first pair of row curr within the block
+		count pos = 0;
+		while (true) {
+			// number of failures before the next success, 1 - urng.real() lies in (0, 1]
+			const double skip = floor(log(1.0 - urng.real()) / log_cp);
+			if (skip >= (double) (blockPairs - pos)) {
+				break;
+			}
+			pos += (count) skip;
+
+			while (pos >= rowOffset + rowLength(curr)) {
+				rowOffset += rowLength(curr);
+				++curr;
+			}
+
+			node v = pos - rowOffset;
+			if (directed && v >= curr) {
+				++v; // skip self-loop
+			}
+			builder.addHalfOutEdge(curr, v);
+
+			if (++pos == blockPairs) {
+				break;
+			}
+		}
+	}
+
+	return builder.toGraph(true, true);
+}
+
 } /* namespace NetworKit */
@@ -22,6 +22,12 @@ protected:
 	count n;
 	double p;
 	bool directed;
+	bool parallel;
+
+	/**
+	 * Parallel variant of the skip-based generation, see generate().
+	 */
+	Graph generateParallel();
 
 public:
 	/**
@@ -32,8 +38,13 @@ public:
 	 * @param nNodes Number of nodes n in the graph.
 	 * @param prob Probability of existence for each edge p.
 	 * @param directed	generates a directed graph
+	 * @param parallel	generate the graph in parallel. The node-pair space is split
+	 *			into blocks of rows, each with its own random stream derived from a
+	 *			single seed drawn from Aux::Random, so the resulting graph does not
+	 *			depend on the number of threads. For directed graphs every ordered
+	 *			pair (u, v) with u != v is a candidate edge.
 	 */
-	ErdosRenyiGenerator(count nNodes, double prob, bool directed=false);
+	ErdosRenyiGenerator(count nNodes, double prob, bool directed=false, bool parallel=false);
 
 	virtual Graph generate();
 };
@@ -5,10 +5,20 @@
  *      Author: Henning, cls
  */
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <queue>
+#include <unistd.h>
+
 #include "RmatGenerator.h"
 #include "../auxiliary/Random.h"
 #include "../auxiliary/NumericTools.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/Enforce.h"
+#include "../auxiliary/Parallel.h"
 
 namespace NetworKit {
 
@@ -23,7 +33,7 @@ RmatGenerator::RmatGenerator(count scale, count edgeFactor, double a, double b,
 }
 
 Graph RmatGenerator::generate() {
-	count n = (1 << scale);
+	count n = ((count) 1 << scale);
 	count numEdges = n * edgeFactor;
 	Graph G(n, true);
 	double ab = a+b;
@@ -94,4 +104,231 @@ Graph RmatGenerator::generate() {
 	return G;
 }
 
+void RmatGenerator::drawEdges(uint64_t seed, index batch, count numberOfEdges, std::vector<std::pair<node, node> >& edges) const {
+	Aux::Random::SplitMix64 urng(seed, batch);
+	const double ab = a+b;
+	const double abc = ab+c;
+
+	edges.resize(numberOfEdges);
+	for (auto& edge : edges) {
+		node u = 0;
+		node v = 0;
+		for (index i = 0; i < scale; ++i) {
+			double r = urng.probability();
+			count q = (r <= a) ? 0 : (r <= ab) ? 1 : (r <= abc) ? 2 : 3;
+			u = (u << 1) | (q >> 1);
+			v = (v << 1) | (q & 1);
+		}
+		edge = std::make_pair(u, v);
+	}
+}
+
+/**
+ * Appends @a edges to @a buffer, either as pairs of 64 bit node ids or as lines "u v".
+ */
+static void formatEdges(const std::vector<std::pair<node, node> >& edges, bool binary, std::string& buffer) {
+	buffer.clear();
+	if (binary) {
+		buffer.resize(edges.size() * 2 * sizeof(node));
+		char* out = &buffer[0];
+		for (const auto& edge : edges) {
+			std::memcpy(out, &edge.first, sizeof(node));
+			std::memcpy(out + sizeof(node), &edge.second, sizeof(node));
+			out += 2 * sizeof(node);
+		}
+	} else {
+		for (const auto& edge : edges) {
+			buffer += std::to_string(edge.first);
+			buffer += ' ';
+			buffer += std::to_string(edge.second);
+			buffer += '\n';
+		}
+	}
+}
+
+namespace {
+
+/**
+ * Temporary files with unique names, removed when the object is destroyed, also if an exception is thrown.
+ */
+class TemporaryFiles {
+public:
+	~TemporaryFiles() {
+		for (const auto& path : paths) {
+			std::remove(path.c_str());
+		}
+	}
+
+	/**
+	 * Creates an empty file whose name starts with @a prefix and returns its path.
+	 */
+	const std::string& create(const std::string& prefix) {
+		std::string pattern = prefix + "XXXXXX";
+		int fd = mkstemp(&pattern[0]);
+		if (fd == -1) {
+			throw std::runtime_error("Cannot create a temporary file next to " + prefix);
+		}
+		close(fd);
+		paths.push_back(pattern);
+		return paths.back();
+	}
+
+private:
+	std::vector<std::string> paths;
+};
+
+} /* anonymous namespace */
+
+void RmatGenerator::writeEdges(const std::string& path, bool binary, bool removeDuplicates, count runSize, count batchSize) {
+	if (batchSize == 0) {
+		throw std::runtime_error("The batch size must be positive");
+	}
+	if (removeDuplicates && runSize < batchSize) {
+		throw std::runtime_error("A run has to hold at least one batch");
+	}
+	std::ofstream file(path, binary ? (std::ios::out | std::ios::binary) : std::ios::out);
+	Aux::enforceOpened(file);
+
+	const count numEdges = ((count) 1 << scale) * edgeFactor;
+	const count nBatches = (numEdges + batchSize - 1) / batchSize;
+	const uint64_t seed = Aux::Random::integer();
+
+	// exceptions must not leave a parallel region, the first one is rethrown after it
+	std::exception_ptr error;
+	std::atomic<bool> failed(false);
+	auto fail = [&]() {
+		#pragma omp critical
+		if (!error) error = std::current_exception();
+		failed = true;
+	};
+
+	if (!removeDuplicates) {
+		#pragma omp parallel
+		{
+			std::vector<std::pair<node, node> > edges;
+			std::string buffer;
+			#pragma omp for ordered schedule(dynamic, 1)
+			for (index batch = 0; batch < nBatches; ++batch) {
+				bool drawn = false;
+				if (!failed) {
+					try {
+						drawEdges(seed, batch, std::min(batchSize, numEdges - batch * batchSize), edges);
+						formatEdges(edges, binary, buffer);
+						drawn = true;
+					} catch (...) {
+						fail();
+					}
+				}
+				#pragma omp ordered
+				{
+					if (drawn && !failed) {
+						try {
+							file.write(buffer.data(), buffer.size());
+						} catch (...) {
+							fail();
+						}
+					}
+				}
+			}
+		}
+		if (error) {
+			std::rethrow_exception(error);
+		}
+		file.close();
+		return;
+	}
+
+	// 1) generate runs of whole batches, sort and deduplicate them and store them in temporary files
+	const count batchesPerRun = runSize / batchSize;
+	const count nRuns = (nBatches + batchesPerRun - 1) / batchesPerRun;
+	// declared before the streams of the runs, so they are closed before the files are removed
+	TemporaryFiles temporaryFiles;
+	std::vector<std::string> runPaths;
+	{
+		std::vector<std::pair<node, node> > run;
+		std::string buffer;
+		for (index r = 0; r < nRuns; ++r) {
+			const index firstBatch = r * batchesPerRun;
+			const index endBatch = std::min(firstBatch + batchesPerRun, nBatches);
+			run.resize(std::min(endBatch * batchSize, numEdges) - firstBatch * batchSize);
+
+			#pragma omp parallel
+			{
+				std::vector<std::pair<node, node> > edges;
+				#pragma omp for schedule(dynamic, 1)
+				for (index batch = firstBatch; batch < endBatch; ++batch) {
+					if (failed) continue;
+					try {
+						drawEdges(seed, batch, std::min(batchSize, numEdges - batch * batchSize), edges);
+					} catch (...) {
+						fail();
+						continue;
+					}
+					index offset = (batch - firstBatch) * batchSize;
+					for (const auto& edge : edges) {
+						run[offset++] = std::make_pair(std::min(edge.first, edge.second), std::max(edge.first, edge.second));
+					}
+				}
+			}
+			if (error) {
+				std::rethrow_exception(error);
+			}
+
+			Aux::Parallel::sort(run.begin(), run.end());
+			run.erase(std::unique(run.begin(), run.end()), run.end());
+			DEBUG("run ", r, " contains ", run.size(), " distinct edges");
+
+			runPaths.push_back(temporaryFiles.create(path + ".run"));
+			std::ofstream runFile(runPaths.back(), std::ios::out | std::ios::binary);
+			Aux::enforceOpened(runFile);
+			formatEdges(run, true, buffer);
+			runFile.write(buffer.data(), buffer.size());
+		}
+	}
+
+	// 2) merge the sorted runs and skip duplicates
+	std::vector<std::ifstream> runFiles;
+	for (const auto& runPath : runPaths) {
+		runFiles.emplace_back(runPath, std::ios::in | std::ios::binary);
+		Aux::enforceOpened(runFiles.back());
+	}
+
+	typedef std::pair<std::pair<node, node>, index> RunHead;
+	std::priority_queue<RunHead, std::vector<RunHead>, std::greater<RunHead> > heads;
+	auto readNext = [&](index r) {
+		node uv[2];
+		if (runFiles[r].read(reinterpret_cast<char*>(uv), sizeof(uv))) {
+			heads.emplace(std::make_pair(uv[0], uv[1]), r);
+		}
+	};
+	for (index r = 0; r < runFiles.size(); ++r) {
+		readNext(r);
+	}
+
+	std::vector<std::pair<node, node> > merged;
+	merged.reserve(batchSize);
+	std::string buffer;
+	while (!heads.empty()) {
+		RunHead head = heads.top();
+		heads.pop();
+		if (merged.empty() || merged.back() != head.first) {
+			merged.push_back(head.first);
+		}
+		readNext(head.second);
+
+		// keep the last edge to detect duplicates that span a flush
+		if (merged.size() == batchSize) {
+			std::pair<node, node> last = merged.back();
+			merged.pop_back();
+			formatEdges(merged, binary, buffer);
+			file.write(buffer.data(), buffer.size());
+			merged.clear();
+			merged.push_back(last);
+		}
+	}
+	formatEdges(merged, binary, buffer);
+	file.write(buffer.data(), buffer.size());
+	file.close();
+}
+
 } /* namespace NetworKit */
@@ -8,8 +8,15 @@
 #ifndef RMATGENERATOR_H_
 #define RMATGENERATOR_H_
 
+#include <atomic>
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "StaticGraphGenerator.h"
 #include "../graph/Graph.h"
+#include "../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -30,6 +37,11 @@ protected:
 	bool weighted;
 	count reduceNodes;
 
+	/**
+	 * Draws @a numberOfEdges edges from the random stream @a batch of the family @a seed into @a edges.
+	 */
+	void drawEdges(uint64_t seed, index batch, count numberOfEdges, std::vector<std::pair<node, node> >& edges) const;
+
 public:
 
 	/**
@@ -48,7 +60,72 @@ public:
 	 * @return Graph to be generated according to parameters specified in constructor.
 	 */
 	Graph generate() override;
+
+	/**
+	 * Generates the edges without building a Graph and passes them on in batches of
+	 * at most @a batchSize edges. Every batch is drawn from its own random stream, so
+	 * the batches only depend on the random seed, not on the number of threads.
+	 * Edges are neither deduplicated nor normalized, weights and @a reduceNodes are ignored.
+	 *
+	 * @param handle Takes parameters <code>(index, std::vector<std::pair<node, node> >&)</code>,
+	 * the id of the batch and its edges. It is called in parallel, once per batch. If it throws,
+	 * the remaining batches are skipped and the first exception is rethrown.
+	 * @param batchSize Maximum number of edges per batch.
+	 */
+	template<typename L> void forEdgeBatches(L handle, count batchSize = defaultBatchSize);
+
+	/**
+	 * Generates the edges in parallel and writes them to @a path without building a Graph.
+	 * The edges are written in batch order, so the file only depends on the random seed.
+	 *
+	 * @param path Output file path.
+	 * @param binary If true, every edge is written as two 64 bit node ids in host byte order,
+	 * otherwise as a line "u v" (readable by EdgeListReader(' ', 0)).
+	 * @param removeDuplicates If true, edges are normalized to u <= v and written once, in sorted
+	 * order. Sorted runs of at most @a runSize edges are stored in uniquely named temporary files
+	 * next to @a path and merged at the end, so memory use is bounded by the run size. The temporary
+	 * files are removed in any case.
+	 * @param runSize Number of edges per sorted run if @a removeDuplicates is set, rounded down to whole
+	 * batches. Must be at least @a batchSize.
+	 * @param batchSize Maximum number of edges per batch, see forEdgeBatches.
+	 */
+	void writeEdges(const std::string& path, bool binary = false, bool removeDuplicates = false, count runSize = 1 << 26, count batchSize = defaultBatchSize);
+
+	static const count defaultBatchSize = 1 << 20;
 };
 
+template<typename L>
+void RmatGenerator::forEdgeBatches(L handle, count batchSize) {
+	if (batchSize == 0) {
+		throw std::runtime_error("The batch size must be positive");
+	}
+	const count numEdges = ((count) 1 << scale) * edgeFactor;
+	const count nBatches = (numEdges + batchSize - 1) / batchSize;
+	const uint64_t seed = Aux::Random::integer();
+
+	// exceptions must not leave the parallel region, the first one is rethrown after it
+	std::exception_ptr error;
+	std::atomic<bool> failed(false);
+	#pragma omp parallel
+	{
+		std::vector<std::pair<node, node> > edges;
+		#pragma omp for schedule(dynamic, 1)
+		for (index batch = 0; batch < nBatches; ++batch) {
+			if (failed) continue;
+			try {
+				drawEdges(seed, batch, std::min(batchSize, numEdges - batch * batchSize), edges);
+				handle(batch, edges);
+			} catch (...) {
+				#pragma omp critical
+				if (!error) error = std::current_exception();
+				failed = true;
+			}
+		}
+	}
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
+
 } /* namespace NetworKit */
 #endif /* RMATGENERATOR_H_ */
@@ -12,6 +12,10 @@ Dy * GeneratorsTest.cpp
 
 #include <numeric>
 #include <cmath>
+#include <omp.h>
+#include <set>
+#include <fstream>
+#include <dirent.h>
 
 #include "../DynamicGraphSource.h"
 #include "../DynamicBarabasiAlbertGenerator.h"
@@ -41,6 +45,7 @@ Dy * GeneratorsTest.cpp
 #include "../../io/DotGraphWriter.h"
 #include "../../io/GraphIO.h"
 #include "../../io/METISGraphReader.h"
+#include "../../io/EdgeListReader.h"
 #include "../../community/Modularity.h"
 #include "../../dynamics/GraphUpdater.h"
 #include "../../auxiliary/MissingMath.h"
@@ -448,6 +453,38 @@ TEST_F(GeneratorsGTest, testErdosRenyiGenerator) {
 	EXPECT_TRUE(G.checkConsistency());
 }
 
+TEST_F(GeneratorsGTest, testErdosRenyiGeneratorParallel) {
+	count n = 2000;
+	double p = 1.5 * (log(n) / (double) n);
+	int maxThreads = omp_get_max_threads();
+
+	for (bool directed : {false, true}) {
+		Aux::Random::setSeed(42, false);
+		omp_set_num_threads(1);
+		Graph G1 = ErdosRenyiGenerator(n, p, directed, true).generate();
+
+		Aux::Random::setSeed(42, false);
+		omp_set_num_threads(4);
+		Graph G2 = ErdosRenyiGenerator(n, p, directed, true).generate();
+		omp_set_num_threads(maxThreads);
+
+		EXPECT_EQ(n, G1.numberOfNodes());
+		EXPECT_TRUE(G1.checkConsistency());
+		EXPECT_EQ(0u, G1.numberOfSelfLoops());
+
+		count nPairs = directed ? n * (n-1) : (n * (n-1)) / 2;
+		count nEdges = G1.numberOfEdges();
+		EXPECT_GE(nEdges, 0.75 * p * nPairs);
+		EXPECT_LE(nEdges, 1.25 * p * nPairs);
+
+		// same seed, different number of threads
+		EXPECT_EQ(G1.numberOfEdges(), G2.numberOfEdges());
+		G1.forEdges([&](node u, node v) {
+			EXPECT_TRUE(G2.hasEdge(u, v));
+		});
+	}
+}
+
 TEST_F(GeneratorsGTest, testRmatGeneratorException) {
 	count scale = 9;
 	count edgeFactor = 12;
@@ -489,6 +526,69 @@ TEST_F(GeneratorsGTest, testRmatGenerator) {
 }
 
 
+TEST_F(GeneratorsGTest, testRmatGeneratorStreaming) {
+	count scale = 9;
+	count n = (1 << scale);
+	count edgeFactor = 12;
+	RmatGenerator rmat(scale, edgeFactor, 0.51, 0.12, 0.12, 0.25);
+
+	// batches cover all edges exactly once
+	std::vector<count> batchSizes(n * edgeFactor / 1000 + 1, 0);
+	rmat.forEdgeBatches([&](index batch, std::vector<std::pair<node, node> >& edges) {
+		batchSizes[batch] = edges.size();
+		for (auto edge : edges) {
+			EXPECT_LT(edge.first, n);
+			EXPECT_LT(edge.second, n);
+		}
+	}, 1000);
+	EXPECT_EQ(n * edgeFactor, std::accumulate(batchSizes.begin(), batchSizes.end(), (count) 0));
+
+	// deduplicated output equals the set of streamed edges
+	Aux::Random::setSeed(42, false);
+	std::set<std::pair<node, node> > expected;
+	rmat.forEdgeBatches([&](index batch, std::vector<std::pair<node, node> >& edges) {
+		#pragma omp critical
+		for (auto edge : edges) {
+			expected.insert(std::make_pair(std::min(edge.first, edge.second), std::max(edge.first, edge.second)));
+		}
+	}, 1000);
+
+	// runs of 2000 edges, so several sorted runs are merged
+	std::string path = "output/rmat-stream.edgelist";
+	Aux::Random::setSeed(42, false);
+	rmat.writeEdges(path, false, true, 2000, 1000);
+
+	std::ifstream file(path);
+	std::vector<std::pair<node, node> > written;
+	node u, v;
+	while (file >> u >> v) {
+		written.emplace_back(u, v);
+	}
+	EXPECT_TRUE(std::is_sorted(written.begin(), written.end()));
+	EXPECT_EQ(expected.size(), written.size());
+	EXPECT_TRUE(std::equal(written.begin(), written.end(), expected.begin()));
+
+	Graph G = EdgeListReader(' ', 0).read(path);
+	EXPECT_EQ(expected.size(), G.numberOfEdges());
+	EXPECT_TRUE(G.checkConsistency());
+
+	// no temporary run files are left behind
+	DIR* dir = opendir("output");
+	ASSERT_NE(nullptr, dir);
+	while (dirent* entry = readdir(dir)) {
+		EXPECT_NE(0u, std::string(entry->d_name).find("rmat-stream.edgelist.run"));
+	}
+	closedir(dir);
+
+	EXPECT_THROW(rmat.writeEdges(path, false, false, 2000, 0), std::runtime_error);
+	EXPECT_THROW(rmat.writeEdges(path, false, true, 500, 1000), std::runtime_error);
+
+	// exceptions thrown by the handle are passed on to the caller
+	EXPECT_THROW(rmat.forEdgeBatches([&](index batch, std::vector<std::pair<node, node> >& edges) {
+		if (batch == 3) throw std::runtime_error("handle failed");
+	}, 1000), std::runtime_error);
+}
+
 TEST_F(GeneratorsGTest, testChungLuGenerator) {
 	count n = 400;
 	count maxDegree = n / 8;
@@ -554,6 +654,37 @@ TEST_F(GeneratorsGTest, testChungLuGeneratorVolumeConsistency) {
     EXPECT_NEAR(G.numberOfEdges() * 2, expectedVolume, 0.2 * expectedVolume);
 }
 
+TEST_F(GeneratorsGTest, testChungLuGeneratorParallel) {
+	count n = 2000;
+	count maxDegree = n / 8;
+	count expectedVolume = 0;
+	std::vector<count> vec;
+	for (index i = 0; i < n; i++) {
+		count deg = Aux::Random::integer(1, maxDegree);
+		vec.push_back(deg);
+		expectedVolume += deg;
+	}
+	int maxThreads = omp_get_max_threads();
+
+	Aux::Random::setSeed(42, false);
+	omp_set_num_threads(1);
+	Graph G1 = ChungLuGenerator(vec, true).generate();
+
+	Aux::Random::setSeed(42, false);
+	omp_set_num_threads(4);
+	Graph G2 = ChungLuGenerator(vec, true).generate();
+	omp_set_num_threads(maxThreads);
+
+	EXPECT_TRUE(G1.checkConsistency());
+	EXPECT_EQ(n, G1.numberOfNodes());
+	EXPECT_NEAR(G1.numberOfEdges() * 2, expectedVolume, 0.2 * expectedVolume);
+
+	EXPECT_EQ(G1.numberOfEdges(), G2.numberOfEdges());
+	G1.forEdges([&](node u, node v) {
+		EXPECT_TRUE(G2.hasEdge(u, v));
+	});
+}
+
 TEST_F(GeneratorsGTest, testHavelHakimiGeneratorOnRandomSequence) {
 	count n = 400;
 	count maxDegree = n / 10;
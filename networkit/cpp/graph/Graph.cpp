@@ -7,9 +7,11 @@
 
 #include <sstream>
 #include <random>
+#include <tuple>
 
 #include "Graph.h"
 #include "GraphBuilder.h"
+#include "../auxiliary/Parallel.h"
 
 namespace NetworKit {
 
@@ -694,6 +696,181 @@ void Graph::removeEdge(node u, node v) {
 	// cause the edge is marked as deleted and we have no null values for the attributes
 }
 
+void Graph::applyEdgeBatch(const std::vector<WeightedEdge>& insertions, const std::vector<Edge>& deletions) {
+	// the entry of an edge in the adjacency array of one of its endpoints
+	struct HalfEdge {
+		node source;
+		bool insertion;
+		node target;
+		edgeweight weight;
+		edgeid eid;
+	};
+
+	// halves stored in outEdges and, for directed graphs, in inEdges
+	std::vector<HalfEdge> outHalves;
+	std::vector<HalfEdge> inHalves;
+	outHalves.reserve(2 * (insertions.size() + deletions.size()));
+	inHalves.reserve(directed ? insertions.size() + deletions.size() : 0);
+
+	auto addHalves = [&](node u, node v, bool insertion, edgeweight ew, edgeid eid) {
+		assert (hasNode(u));
+		assert (hasNode(v));
+		outHalves.push_back({u, insertion, v, ew, eid});
+		if (directed) {
+			inHalves.push_back({v, insertion, u, ew, eid});
+		} else if (u != v) {
+			outHalves.push_back({v, insertion, u, ew, eid});
+		}
+	};
+
+	count deletedSelfLoops = 0;
+	for (const Edge& e : deletions) {
+		addHalves(e.u, e.v, false, nullWeight, none);
+		if (e.u == e.v) {
+			deletedSelfLoops++;
+		}
+	}
+	count insertedSelfLoops = 0;
+	for (index i = 0; i < insertions.size(); ++i) {
+		const WeightedEdge& e = insertions[i];
+		addHalves(e.u, e.v, true, weighted ? e.weight : defaultEdgeWeight, edgesIndexed ? omega + i : none);
+		if (e.u == e.v) {
+			insertedSelfLoops++;
+		}
+	}
+
+	// group by source, deletions first, each part sorted by target
+	auto halfEdgeLess = [](const HalfEdge& a, const HalfEdge& b) {
+		return std::tie(a.source, a.insertion, a.target) < std::tie(b.source, b.insertion, b.target);
+	};
+	Aux::Parallel::sort(outHalves.begin(), outHalves.end(), halfEdgeLess);
+	Aux::Parallel::sort(inHalves.begin(), inHalves.end(), halfEdgeLess);
+
+	auto groupsOf = [](const std::vector<HalfEdge>& halves) {
+		std::vector<index> begin;
+		for (index i = 0; i < halves.size(); ++i) {
+			if (i == 0 || halves[i].source != halves[i - 1].source) {
+				begin.push_back(i);
+			}
+		}
+		begin.push_back(halves.size());
+		return begin;
+	};
+
+	// position of the first insertion in the group [first, last)
+	auto firstInsertion = [](const HalfEdge* first, const HalfEdge* last) {
+		return std::find_if(first, last, [](const HalfEdge& h) { return h.insertion; });
+	};
+
+	// marks the first unused deletion of an entry with target x in the deletions [first, last), so that
+	// every deletion of a multi-edge removes exactly one of its entries
+	auto consumeDeletion = [](const HalfEdge* first, const HalfEdge* last, node x, std::vector<bool>& used) {
+		const HalfEdge* it = std::lower_bound(first, last, x, [](const HalfEdge& h, node y) { return h.target < y; });
+		for (; it != last && it->target == x; ++it) {
+			if (!used[it - first]) {
+				used[it - first] = true;
+				return true;
+			}
+		}
+		return false;
+	};
+
+	const std::vector<index> outGroups = groupsOf(outHalves);
+	const std::vector<index> inGroups = groupsOf(inHalves);
+
+	// 1) make sure all deletions exist before anything is modified
+	bool missing = false;
+	Edge missingEdge(none, none);
+	#pragma omp parallel for schedule(guided)
+	for (index g = 0; g < outGroups.size() - 1; ++g) {
+		const HalfEdge* first = outHalves.data() + outGroups[g];
+		const HalfEdge* last = firstInsertion(first, outHalves.data() + outGroups[g + 1]);
+		if (first == last) {
+			continue;
+		}
+		std::vector<bool> found(last - first, false);
+		for (node x : outEdges[first->source]) {
+			if (x != none) {
+				consumeDeletion(first, last, x, found);
+			}
+		}
+		for (index i = 0; i < found.size(); ++i) {
+			if (!found[i]) {
+				#pragma omp critical
+				{
+					missing = true;
+					missingEdge = Edge(first->source, first[i].target);
+				}
+				break;
+			}
+		}
+	}
+	if (missing) {
+		std::stringstream strm;
+		strm << "edge (" << missingEdge.u << "," << missingEdge.v << ") does not exist";
+		throw std::runtime_error(strm.str());
+	}
+
+	// 2) rewrite every affected adjacency array once: drop deleted and removed entries, append insertions
+	auto rewrite = [&](const std::vector<HalfEdge>& halves, const std::vector<index>& groups, std::vector<std::vector<node> >& adjacencies,
+			std::vector<std::vector<edgeweight> >& weights, std::vector<std::vector<edgeid> >& ids, std::vector<count>& degrees) {
+		#pragma omp parallel for schedule(guided)
+		for (index g = 0; g < groups.size() - 1; ++g) {
+			const HalfEdge* first = halves.data() + groups[g];
+			const HalfEdge* last = halves.data() + groups[g + 1];
+			const HalfEdge* mid = firstInsertion(first, last);
+			const node u = first->source;
+
+			std::vector<node>& adjacency = adjacencies[u];
+			std::vector<bool> deleted(mid - first, false);
+			index j = 0;
+			for (index i = 0; i < adjacency.size(); ++i) {
+				node x = adjacency[i];
+				if (x == none || (first != mid && consumeDeletion(first, mid, x, deleted))) {
+					continue;
+				}
+				adjacency[j] = x;
+				if (weighted) {
+					weights[u][j] = weights[u][i];
+				}
+				if (edgesIndexed) {
+					ids[u][j] = ids[u][i];
+				}
+				++j;
+			}
+			adjacency.resize(j);
+			if (weighted) {
+				weights[u].resize(j);
+			}
+			if (edgesIndexed) {
+				ids[u].resize(j);
+			}
+
+			for (const HalfEdge* h = mid; h != last; ++h) {
+				adjacency.push_back(h->target);
+				if (weighted) {
+					weights[u].push_back(h->weight);
+				}
+				if (edgesIndexed) {
+					ids[u].push_back(h->eid);
+				}
+			}
+			degrees[u] = adjacency.size();
+		}
+	};
+
+	rewrite(outHalves, outGroups, outEdges, outEdgeWeights, outEdgeIds, outDeg);
+	if (directed) {
+		rewrite(inHalves, inGroups, inEdges, inEdgeWeights, inEdgeIds, inDeg);
+	}
+
+	m = m + insertions.size() - deletions.size();
+	storedNumberOfSelfLoops = storedNumberOfSelfLoops + insertedSelfLoops - deletedSelfLoops;
+	if (edgesIndexed) {
+		omega += insertions.size();
+	}
+}
+
 void Graph::removeSelfLoops() {
 	this->forEdges([&](node u, node v, edgeweight ew) {
 		if (u == v) {
@@ -643,6 +643,19 @@ public:
 	 */
 	void removeEdge(node u, node v);
 
+	/**
+	 * Applies a batch of edge updates: first all @a deletions are removed, then all
+	 * @a insertions are added. The updates are grouped by endpoint and every affected
+	 * adjacency array is rewritten once, in parallel, which also compacts the slots of
+	 * previously removed edges. Use this instead of removeEdge/addEdge when many edges
+	 * change at once, since removeEdge searches the adjacency array for every edge.
+	 * If one of the @a deletions does not exist, a std::runtime_error is thrown and the
+	 * graph is not modified.
+	 * @param insertions Edges to insert. Weights are ignored for unweighted graphs.
+	 * @param deletions Edges to remove.
+	 */
+	void applyEdgeBatch(const std::vector<WeightedEdge>& insertions, const std::vector<Edge>& deletions);
+
 	/**
 	 * Removes all self-loops in the graph.
 	 */
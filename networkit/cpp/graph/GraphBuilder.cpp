@@ -5,6 +5,7 @@
  *      Author: Marvin Ritter (marvin.ritter@gmail.com)
  */
 
+#include <algorithm>
 #include <stdexcept>
 #include <omp.h>
 
@@ -148,6 +149,89 @@ void GraphBuilder::increaseInWeight(node u, node v, edgeweight ew) {
 	}
 }
 
+void GraphBuilder::addEdges(count m, const node* sources, const node* targets, const edgeweight* weights, bool removeSelfLoops, bool removeMultiEdges) {
+	bool valid = true;
+	#pragma omp parallel for reduction(&&:valid)
+	for (index i = 0; i < m; i++) {
+		valid = valid && sources[i] < n && targets[i] < n;
+	}
+	if (!valid) {
+		throw std::runtime_error("Edge with an end node that does not exist");
+	}
+	if (weights != nullptr && !weighted) {
+		throw std::runtime_error("Edge weights given for an unweighted graph");
+	}
+
+	// edge i is stored at owner(i) and points to neighbor(i)
+	auto owner = [&](index i) {
+		return directed ? sources[i] : std::min(sources[i], targets[i]);
+	};
+	auto neighbor = [&](index i) {
+		return directed ? targets[i] : std::max(sources[i], targets[i]);
+	};
+	auto skip = [&](index i) {
+		return removeSelfLoops && sources[i] == targets[i];
+	};
+
+	// counting sort of the edge indices by owner
+	std::vector<index> offsets(n + 1, 0);
+	#pragma omp parallel for
+	for (index i = 0; i < m; i++) {
+		if (!skip(i)) {
+			#pragma omp atomic update
+			offsets[owner(i) + 1]++;
+		}
+	}
+	for (node u = 0; u < n; u++) {
+		offsets[u + 1] += offsets[u];
+	}
+	std::vector<index> edges(offsets[n]);
+	std::vector<index> position(offsets.begin(), offsets.end() - 1);
+	#pragma omp parallel for
+	for (index i = 0; i < m; i++) {
+		if (!skip(i)) {
+			index p;
+			#pragma omp atomic capture
+			p = position[owner(i)]++;
+			edges[p] = i;
+		}
+	}
+
+	count addedSelfLoops = 0;
+	#pragma omp parallel for schedule(dynamic, 100) reduction(+:addedSelfLoops)
+	for (node u = 0; u < n; u++) {
+		auto first = edges.begin() + offsets[u];
+		auto last = edges.begin() + offsets[u + 1];
+		if (removeMultiEdges) {
+			// sorting by neighbor and input position keeps the first of equal edges in front
+			std::sort(first, last, [&](index i, index j) {
+				return std::make_pair(neighbor(i), i) < std::make_pair(neighbor(j), j);
+			});
+			last = std::unique(first, last, [&](index i, index j) {
+				return neighbor(i) == neighbor(j);
+			});
+		} else {
+			// the positions of the atomic counting sort depend on the thread schedule
+			std::sort(first, last);
+		}
+		outEdges[u].reserve(outEdges[u].size() + (last - first));
+		if (weighted) {
+			outEdgeWeights[u].reserve(outEdgeWeights[u].size() + (last - first));
+		}
+		for (auto it = first; it != last; ++it) {
+			node v = neighbor(*it);
+			outEdges[u].push_back(v);
+			if (weighted) {
+				outEdgeWeights[u].push_back(weights == nullptr ? defaultEdgeWeight : weights[*it]);
+			}
+			if (u == v) {
+				addedSelfLoops++;
+			}
+		}
+	}
+	selfloops += addedSelfLoops;
+}
+
 Graph GraphBuilder::toGraph(bool autoCompleteEdges, bool parallel) {
 	Graph G(n, weighted, directed);
 	if (name != "") {
@@ -137,6 +137,24 @@ public:
 	void increaseOutWeight(node u, node v, edgeweight ew);
 	void increaseInWeight(node u, node v, edgeweight ew);
 
+	/**
+	 * Adds @a m edges given in coordinate form: the i-th edge goes from @a sources[i] to @a targets[i]
+	 * and has the weight @a weights[i], or the default weight if @a weights is null. The edges are
+	 * grouped by end node with a parallel counting sort and added as first half edges, so the graph
+	 * has to be generated with toGraph(true). In undirected graphs, each edge is stored at its smaller
+	 * end node. The edges of a node are added in input order, or ordered by neighbor if multi-edges
+	 * are removed. Not threadsafe, and no other edges must be added concurrently.
+	 *
+	 * @param m Number of edges.
+	 * @param sources Source nodes of the edges.
+	 * @param targets Target nodes of the edges.
+	 * @param weights Weights of the edges, may be null.
+	 * @param removeSelfLoops If set to @c true, self loops are skipped.
+	 * @param removeMultiEdges If set to @c true, only the first of several edges between the same
+	 * nodes in the given arrays is added. In undirected graphs, the edges (u, v) and (v, u) are the same.
+	 */
+	void addEdges(count m, const node* sources, const node* targets, const edgeweight* weights = nullptr, bool removeSelfLoops = false, bool removeMultiEdges = false);
+
 	/**
 	 * Generates a Graph instance. The graph builder will be reseted at the end.
 	 */
@@ -0,0 +1,252 @@
+/*
+ * NodeReordering.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "NodeReordering.h"
+#include "GraphBuilder.h"
+#include "../auxiliary/Parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <stdexcept>
+
+namespace NetworKit {
+
+namespace NodeReordering {
+
+namespace {
+
+std::vector<node> orderToIds(const Graph& G, const std::vector<node>& order) {
+	assert (order.size() == G.numberOfNodes());
+	std::vector<node> newIds(G.upperNodeIdBound(), none);
+	#pragma omp parallel for
+	for (index i = 0; i < order.size(); ++i) {
+		newIds[order[i]] = i;
+	}
+	return newIds;
+}
+
+/**
+ * Appends the nodes reachable from @a source to @a order in breadth-first order. If @a byDegree is set,
+ * the neighbors of each node are visited by increasing degree.
+ */
+void appendBFS(const Graph& G, node source, std::vector<uint8_t>& visited, std::vector<node>& order, bool byDegree) {
+	index head = order.size();
+	visited[source] = 1;
+	order.push_back(source);
+	while (head < order.size()) {
+		node u = order[head++];
+		index first = order.size();
+		G.forNeighborsOf(u, [&](node v) {
+			if (!visited[v]) {
+				visited[v] = 1;
+				order.push_back(v);
+			}
+		});
+		if (byDegree) {
+			std::stable_sort(order.begin() + first, order.end(), [&](node a, node b) {
+				return G.degree(a) < G.degree(b);
+			});
+		}
+	}
+}
+
+} /* anonymous namespace */
+
+std::vector<node> reverseCuthillMcKee(const Graph& G) {
+	std::vector<node> starts = G.nodes();
+	std::stable_sort(starts.begin(), starts.end(), [&](node a, node b) {
+		return G.degree(a) < G.degree(b);
+	});
+
+	std::vector<uint8_t> visited(G.upperNodeIdBound(), 0);
+	std::vector<node> order;
+	order.reserve(G.numberOfNodes());
+	for (node s : starts) {
+		if (!visited[s]) {
+			appendBFS(G, s, visited, order, true);
+		}
+	}
+	std::reverse(order.begin(), order.end());
+	return orderToIds(G, order);
+}
+
+std::vector<node> degreeDescending(const Graph& G) {
+	std::vector<node> order = G.nodes();
+	Aux::Parallel::sort(order.begin(), order.end(), [&](node a, node b) {
+		count da = G.degree(a);
+		count db = G.degree(b);
+		return da > db || (da == db && a < b);
+	});
+	return orderToIds(G, order);
+}
+
+std::vector<node> bfsOrder(const Graph& G, node source) {
+	if (source != none && !G.hasNode(source)) {
+		throw std::runtime_error("The source is not a node of the graph.");
+	}
+	std::vector<uint8_t> visited(G.upperNodeIdBound(), 0);
+	std::vector<node> order;
+	order.reserve(G.numberOfNodes());
+	if (source != none) {
+		appendBFS(G, source, visited, order, false);
+	}
+	G.forNodes([&](node s) {
+		if (!visited[s]) {
+			appendBFS(G, s, visited, order, false);
+		}
+	});
+	return orderToIds(G, order);
+}
+
+std::vector<node> communityOrder(const Graph& G, const Partition& zeta) {
+	if (zeta.numberOfElements() < G.upperNodeIdBound()) {
+		throw std::runtime_error("The partition does not cover all nodes of the graph.");
+	}
+
+	// rank the subsets by their first node and count their sizes
+	std::vector<index> rank(zeta.upperBound(), none);
+	std::vector<count> offset;
+	G.forNodes([&](node v) {
+		index s = zeta[v];
+		if (s == none) {
+			throw std::runtime_error("Every node has to be assigned to a subset.");
+		}
+		if (rank[s] == none) {
+			rank[s] = offset.size();
+			offset.push_back(0);
+		}
+		++offset[rank[s]];
+	});
+
+	// counting sort, stable with respect to the ids
+	count sum = 0;
+	for (count& o : offset) {
+		count size = o;
+		o = sum;
+		sum += size;
+	}
+	std::vector<node> newIds(G.upperNodeIdBound(), none);
+	G.forNodes([&](node v) {
+		newIds[v] = offset[rank[zeta[v]]]++;
+	});
+	return newIds;
+}
+
+std::vector<node> gorder(const Graph& G, count window) {
+	if (window == 0) {
+		throw std::runtime_error("The window must not be empty.");
+	}
+	const count n = G.numberOfNodes();
+	const count hubDegree = (count) std::sqrt((double) n);
+
+	// unplaced nodes with a positive score, the highest score last
+	std::vector<count> score(G.upperNodeIdBound(), 0);
+	std::vector<uint8_t> placed(G.upperNodeIdBound(), 0);
+	std::set<std::pair<count, node>> candidates;
+	auto changeScore = [&](node x, bool increase) {
+		if (placed[x]) {
+			return;
+		}
+		if (score[x] > 0) {
+			candidates.erase(std::make_pair(score[x], x));
+		}
+		if (increase) {
+			++score[x];
+		} else {
+			--score[x];
+		}
+		if (score[x] > 0) {
+			candidates.insert(std::make_pair(score[x], x));
+		}
+	};
+	// v enters or leaves the window
+	auto updateWindow = [&](node v, bool enters) {
+		G.forNeighborsOf(v, [&](node u) {
+			changeScore(u, enters);
+			if (G.degree(u) <= hubDegree) {
+				G.forNeighborsOf(u, [&](node x) {
+					if (x != v) {
+						changeScore(x, enters);
+					}
+				});
+			}
+		});
+	};
+
+	std::vector<node> byDegree = G.nodes();
+	std::stable_sort(byDegree.begin(), byDegree.end(), [&](node a, node b) {
+		return G.degree(a) > G.degree(b);
+	});
+	index nextByDegree = 0;
+
+	std::vector<node> order;
+	order.reserve(n);
+	while (order.size() < n) {
+		node v;
+		if (candidates.empty()) {
+			while (placed[byDegree[nextByDegree]]) {
+				++nextByDegree;
+			}
+			v = byDegree[nextByDegree];
+		} else {
+			v = std::prev(candidates.end())->second;
+			candidates.erase(std::prev(candidates.end()));
+		}
+		placed[v] = 1;
+		order.push_back(v);
+
+		updateWindow(v, true);
+		if (order.size() > window) {
+			updateWindow(order[order.size() - window - 1], false);
+		}
+	}
+	return orderToIds(G, order);
+}
+
+Graph relabel(const Graph& G, const std::vector<node>& newIds) {
+	const count n = G.numberOfNodes();
+	if (newIds.size() < G.upperNodeIdBound()) {
+		throw std::runtime_error("The mapping does not cover all nodes of the graph.");
+	}
+	std::vector<uint8_t> used(n, 0);
+	G.forNodes([&](node u) {
+		node id = newIds[u];
+		if (id >= n || used[id]) {
+			throw std::runtime_error("The mapping is not a bijection to 0, ..., n-1.");
+		}
+		used[id] = 1;
+	});
+
+	// each edge is added once, the builder completes the other half
+	GraphBuilder builder(n, G.isWeighted(), G.isDirected());
+	G.parallelForEdges([&](node u, node v, edgeweight w) {
+		builder.addHalfOutEdge(newIds[u], newIds[v], w);
+	});
+	Graph R = builder.toGraph(true, true);
+	R.sortEdges();
+	return R;
+}
+
+std::vector<node> invert(const std::vector<node>& newIds) {
+	count n = 0;
+	for (node id : newIds) {
+		if (id != none) {
+			n = std::max(n, id + 1);
+		}
+	}
+	std::vector<node> oldIds(n, none);
+	for (index u = 0; u < newIds.size(); ++u) {
+		if (newIds[u] != none) {
+			oldIds[newIds[u]] = u;
+		}
+	}
+	return oldIds;
+}
+
+} /* namespace NodeReordering */
+
+} /* namespace NetworKit */
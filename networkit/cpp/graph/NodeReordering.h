@@ -0,0 +1,82 @@
+/*
+ * NodeReordering.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NODEREORDERING_H_
+#define NODEREORDERING_H_
+
+#include "Graph.h"
+#include "../structures/Partition.h"
+
+#include <vector>
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Node orderings that improve the memory locality of graph traversals. Most algorithms iterate
+ * over the nodes in id order and access the data of their neighbors, so ids that place neighbors
+ * close to each other make these accesses cache friendly.
+ *
+ * Every ordering is returned as a vector mapping each node id of the graph to its new id, the
+ * entries of deleted nodes are none. The new ids are 0, ..., n-1, so relabel() yields a compact
+ * graph. On directed graphs only the outgoing edges are considered.
+ */
+namespace NodeReordering {
+
+/**
+ * Reverse Cuthill-McKee ordering: every connected component is traversed in breadth-first order,
+ * starting at a node of minimum degree and visiting the neighbors by increasing degree, and the
+ * resulting order is reversed. This reduces the bandwidth of the adjacency matrix.
+ */
+std::vector<node> reverseCuthillMcKee(const Graph& G);
+
+/**
+ * Orders the nodes by descending degree, ties are kept in id order. Hubs, whose data is accessed
+ * most often, end up next to each other.
+ */
+std::vector<node> degreeDescending(const Graph& G);
+
+/**
+ * Breadth-first order starting at @a source, the remaining components are traversed in id order.
+ * If @a source is none, the traversal starts at the first node.
+ */
+std::vector<node> bfsOrder(const Graph& G, node source = none);
+
+/**
+ * Places the nodes of each subset of @a zeta consecutively, e.g. communities found by PLM or PLP.
+ * Subsets are ordered by their first node and within a subset the nodes keep their id order.
+ */
+std::vector<node> communityOrder(const Graph& G, const Partition& zeta);
+
+/**
+ * Greedy window ordering following Gorder (Wei, Yu, Lu, Lin: "Speedup Graph Processing by Graph
+ * Ordering"). The next node is the one with the highest score with respect to the last @a window
+ * placed nodes, where a node scores one for each of them it is adjacent to and one for each common
+ * neighbor. Neighbors with a degree above sqrt(n) are not considered as common neighbors, which bounds
+ * the work per node. If no unplaced node has a positive score, the unplaced node of highest degree follows.
+ */
+std::vector<node> gorder(const Graph& G, count window = 5);
+
+/**
+ * Computes the graph in which node u of @a G has id @a newIds[u]. The adjacency arrays of the result
+ * are sorted, edge weights are kept.
+ *
+ * @param G The graph.
+ * @param newIds A bijection from the nodes of @a G to 0, ..., n-1, e.g. one of the orderings above.
+ * @return The relabelled graph with n nodes.
+ */
+Graph relabel(const Graph& G, const std::vector<node>& newIds);
+
+/**
+ * @return The inverse of @a newIds, i.e. the original id of every new id.
+ */
+std::vector<node> invert(const std::vector<node>& newIds);
+
+} /* namespace NodeReordering */
+
+} /* namespace NetworKit */
+
+#endif /* NODEREORDERING_H_ */
@@ -6,7 +6,6 @@
  */
 
 #include "Sampling.h"
-#include "../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -19,6 +18,15 @@ node Sampling::randomNode(const Graph& G) {
 	return v;
 }
 
+node Sampling::randomNode(const Graph& G, Aux::Random::SplitMix64& urng) {
+	assert (G.numberOfNodes() > 0);
+	node v = none;
+	do {
+		v = urng.index(G.upperNodeIdBound());
+	} while (!G.hasNode(v));
+	return v;
+}
+
 // the following methdods are commented in order to create linker-errors should they be used before
 // they are actually defined (not returning from a function with a returntype != void is UB):
 
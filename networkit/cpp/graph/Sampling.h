@@ -9,6 +9,7 @@
 #define SAMPLING_H_
 
  #include "Graph.h"
+#include "../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -21,6 +22,11 @@ public:
 
 	static node randomNode(const Graph& G);
 
+	/**
+	 * @returns a node chosen uniformly at random, drawing from @a urng instead of the thread-local generator.
+	 */
+	static node randomNode(const Graph& G, Aux::Random::SplitMix64& urng);
+
 	static std::pair<node, node> randomEdge(const Graph& G);
 
 	static node randomNeighbor(const Graph& G, node u);
@@ -257,6 +257,53 @@ TEST_P(GraphBuilderAutoCompleteGTest, testNumberOfSelfLoops) {
 	ASSERT_EQ(1u, G.numberOfSelfLoops());
 }
 
+TEST_P(GraphBuilderAutoCompleteGTest, testAddEdges) {
+	const std::vector<node> sources = {0, 1, 1, 3, 0, 2, 3};
+	const std::vector<node> targets = {1, 2, 0, 3, 1, 3, 3};
+	const std::vector<edgeweight> weights = {1, 2, 3, 4, 5, 6, 7};
+	const edgeweight* w = isWeighted() ? weights.data() : nullptr;
+
+	auto build = [&](bool removeSelfLoops, bool removeMultiEdges) {
+		auto b = createGraphBuilder(4);
+		b.addEdges(sources.size(), sources.data(), targets.data(), w, removeSelfLoops, removeMultiEdges);
+		return toGraph(b);
+	};
+
+	Graph G = build(false, false);
+	Graph expected(4, isWeighted(), isDirected());
+	for (index i = 0; i < sources.size(); i++) {
+		expected.addEdge(sources[i], targets[i], isWeighted() ? weights[i] : defaultEdgeWeight);
+	}
+	ASSERT_EQ(7u, G.numberOfEdges());
+	ASSERT_EQ(2u, G.numberOfSelfLoops());
+	ASSERT_EQ(expected.totalEdgeWeight(), G.totalEdgeWeight());
+	G.forNodes([&](node u) {
+		ASSERT_EQ(expected.degreeOut(u), G.degreeOut(u));
+		ASSERT_EQ(expected.degreeIn(u), G.degreeIn(u));
+	});
+
+	G = build(true, false);
+	ASSERT_EQ(5u, G.numberOfEdges());
+	ASSERT_EQ(0u, G.numberOfSelfLoops());
+
+	// the first of equal edges is kept
+	G = build(false, true);
+	ASSERT_EQ(isDirected() ? 5u : 4u, G.numberOfEdges());
+	ASSERT_EQ(1u, G.numberOfSelfLoops());
+	ASSERT_EQ(isWeighted() ? 1.0 : defaultEdgeWeight, G.weight(0, 1));
+	ASSERT_EQ(isWeighted() ? 4.0 : defaultEdgeWeight, G.weight(3, 3));
+	if (isDirected()) {
+		ASSERT_EQ(isWeighted() ? 3.0 : defaultEdgeWeight, G.weight(1, 0));
+	}
+
+	G = build(true, true);
+	ASSERT_EQ(isDirected() ? 4u : 3u, G.numberOfEdges());
+
+	const std::vector<node> invalid = {0, 4};
+	auto b = createGraphBuilder(4);
+	EXPECT_THROW(b.addEdges(1, invalid.data(), invalid.data() + 1), std::runtime_error);
+}
+
 TEST_P(GraphBuilderAutoCompleteGTest, testUpperNodeIdBound) {
 	ASSERT_EQ(5u, this->bHouse.upperNodeIdBound());
 	Graph Ghouse = toGraph(this->bHouse);
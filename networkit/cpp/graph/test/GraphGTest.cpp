@@ -641,6 +641,98 @@ TEST_P(GraphGTest, testAddEdge) {
 	}
 }
 
+TEST_P(GraphGTest, testApplyEdgeBatch) {
+	Aux::Random::setSeed(42, false);
+	const count n = 50;
+	Graph G = createGraph(n);
+	G.forNodePairs([&](node u, node v) {
+		if (Aux::Random::probability() < 0.2) {
+			G.addEdge(u, v, Aux::Random::real());
+		}
+	});
+	G.addEdge(3, 3);
+	// leaves an empty slot in the adjacency arrays
+	std::pair<node, node> removed = G.randomEdge();
+	G.removeEdge(removed.first, removed.second);
+	G.indexEdges();
+
+	std::vector<Edge> deletions;
+	G.forEdges([&](node u, node v) {
+		if (u == v || Aux::Random::probability() < 0.3) {
+			deletions.emplace_back(u, v);
+		}
+	});
+	std::vector<WeightedEdge> insertions;
+	G.forNodePairs([&](node u, node v) {
+		if (!G.hasEdge(u, v) && !G.hasEdge(v, u) && Aux::Random::probability() < 0.1) {
+			insertions.emplace_back(u, v, Aux::Random::real());
+		}
+	});
+	insertions.emplace_back(7, 7, 2.0);
+
+	Graph expected = G;
+	for (const Edge& e : deletions) {
+		expected.removeEdge(e.u, e.v);
+	}
+	for (const WeightedEdge& e : insertions) {
+		expected.addEdge(e.u, e.v, e.weight);
+	}
+
+	G.applyEdgeBatch(insertions, deletions);
+
+	EXPECT_TRUE(G.checkConsistency());
+	EXPECT_EQ(expected.numberOfEdges(), G.numberOfEdges());
+	EXPECT_EQ(expected.numberOfSelfLoops(), G.numberOfSelfLoops());
+	EXPECT_EQ(expected.upperEdgeIdBound(), G.upperEdgeIdBound());
+	G.forNodes([&](node u) {
+		EXPECT_EQ(expected.degree(u), G.degree(u));
+		EXPECT_EQ(expected.degreeIn(u), G.degreeIn(u));
+	});
+	expected.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+		ASSERT_TRUE(G.hasEdge(u, v));
+		EXPECT_EQ(w, G.weight(u, v));
+		EXPECT_EQ(eid, G.edgeId(u, v));
+	});
+
+	// deleting a missing edge throws and leaves the graph untouched
+	count m = G.numberOfEdges();
+	std::vector<Edge> invalid = {Edge(insertions[0].u, insertions[0].v), Edge(insertions[0].u, insertions[0].v)};
+	EXPECT_THROW(G.applyEdgeBatch({}, invalid), std::runtime_error);
+	EXPECT_EQ(m, G.numberOfEdges());
+	EXPECT_TRUE(G.hasEdge(insertions[0].u, insertions[0].v));
+}
+
+TEST_P(GraphGTest, testApplyEdgeBatchMultiEdges) {
+	Graph G = createGraph(3);
+	for (index i = 0; i < 3; ++i) {
+		G.addEdge(0, 1);
+	}
+	G.addEdge(1, 1);
+	G.addEdge(1, 1);
+	G.addEdge(1, 2);
+
+	// each deletion removes one copy of a multi-edge
+	G.applyEdgeBatch({}, {Edge(0, 1), Edge(0, 1), Edge(1, 1)});
+
+	EXPECT_TRUE(G.checkConsistency());
+	EXPECT_EQ(3u, G.numberOfEdges());
+	EXPECT_EQ(1u, G.numberOfSelfLoops());
+	count copies = 0;
+	G.forEdges([&](node u, node v) {
+		if (std::minmax(u, v) == std::minmax<node>(0, 1)) {
+			copies++;
+		}
+	});
+	EXPECT_EQ(1u, copies);
+	EXPECT_EQ(1u, G.degreeOut(0));
+	EXPECT_TRUE(G.hasEdge(1, 1));
+	EXPECT_TRUE(G.hasEdge(1, 2));
+
+	// more deletions than copies throw
+	EXPECT_THROW(G.applyEdgeBatch({}, {Edge(0, 1), Edge(0, 1)}), std::runtime_error);
+	EXPECT_EQ(3u, G.numberOfEdges());
+}
+
 TEST_P(GraphGTest, testRemoveEdge) {
 	double epsilon = 1e-6;
 	Graph G = createGraph(3);
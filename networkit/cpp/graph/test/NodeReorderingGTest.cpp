@@ -0,0 +1,165 @@
+/*
+ * NodeReorderingGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "NodeReorderingGTest.h"
+#include "../NodeReordering.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+#include "../../community/PLP.h"
+#include "../../auxiliary/Random.h"
+
+#include <algorithm>
+#include <map>
+
+namespace NetworKit {
+
+namespace {
+
+void expectBijection(const Graph& G, const std::vector<node>& newIds) {
+	ASSERT_EQ(G.upperNodeIdBound(), newIds.size());
+	std::vector<bool> used(G.numberOfNodes(), false);
+	for (node u = 0; u < G.upperNodeIdBound(); ++u) {
+		if (G.hasNode(u)) {
+			ASSERT_LT(newIds[u], G.numberOfNodes());
+			EXPECT_FALSE(used[newIds[u]]);
+			used[newIds[u]] = true;
+		} else {
+			EXPECT_EQ(none, newIds[u]);
+		}
+	}
+}
+
+count bandwidth(const Graph& G) {
+	count result = 0;
+	G.forEdges([&](node u, node v) {
+		result = std::max(result, u > v ? u - v : v - u);
+	});
+	return result;
+}
+
+} /* anonymous namespace */
+
+TEST_F(NodeReorderingGTest, testOrderingsAreBijections) {
+	Aux::Random::setSeed(1, false);
+	ErdosRenyiGenerator generator(300, 0.02);
+	Graph G = generator.generate();
+	for (node u = 0; u < 300; u += 7) {
+		std::vector<node> neighbors;
+		G.forNeighborsOf(u, [&](node v) {
+			neighbors.push_back(v);
+		});
+		for (node v : neighbors) {
+			G.removeEdge(u, v);
+		}
+		G.removeNode(u);
+	}
+	node isolated = G.addNode();
+
+	expectBijection(G, NodeReordering::reverseCuthillMcKee(G));
+	expectBijection(G, NodeReordering::degreeDescending(G));
+	expectBijection(G, NodeReordering::bfsOrder(G));
+	expectBijection(G, NodeReordering::bfsOrder(G, isolated));
+	expectBijection(G, NodeReordering::gorder(G));
+	expectBijection(G, NodeReordering::gorder(G, 1));
+
+	PLP plp(G);
+	plp.run();
+	Partition zeta = plp.getPartition();
+	std::vector<node> newIds = NodeReordering::communityOrder(G, zeta);
+	expectBijection(G, newIds);
+
+	// every community occupies a contiguous range of ids
+	std::map<index, std::pair<node, node>> range;
+	std::map<index, count> size;
+	G.forNodes([&](node u) {
+		index s = zeta[u];
+		if (!range.count(s)) {
+			range[s] = std::make_pair(newIds[u], newIds[u]);
+		}
+		range[s].first = std::min(range[s].first, newIds[u]);
+		range[s].second = std::max(range[s].second, newIds[u]);
+		++size[s];
+	});
+	for (auto& r : range) {
+		EXPECT_EQ(size[r.first], r.second.second - r.second.first + 1);
+	}
+
+	EXPECT_EQ(0u, NodeReordering::bfsOrder(G, isolated)[isolated]);
+	EXPECT_THROW(NodeReordering::bfsOrder(G, 0), std::runtime_error);
+}
+
+TEST_F(NodeReorderingGTest, testDegreeDescending) {
+	Graph G(5);
+	G.addEdge(3, 0);
+	G.addEdge(3, 1);
+	G.addEdge(3, 2);
+	G.addEdge(1, 2);
+	std::vector<node> newIds = NodeReordering::degreeDescending(G);
+	std::vector<node> expected = {3, 1, 2, 0, 4};
+	EXPECT_EQ(expected, NodeReordering::invert(newIds));
+}
+
+TEST_F(NodeReorderingGTest, testReverseCuthillMcKeeOnShuffledPath) {
+	count n = 100;
+	std::vector<node> perm(n);
+	for (node u = 0; u < n; ++u) {
+		perm[u] = u;
+	}
+	std::shuffle(perm.begin(), perm.end(), Aux::Random::getURNG());
+	Graph G(n);
+	for (node u = 0; u + 1 < n; ++u) {
+		G.addEdge(perm[u], perm[u + 1]);
+	}
+	EXPECT_GT(bandwidth(G), 1u);
+
+	Graph R = NodeReordering::relabel(G, NodeReordering::reverseCuthillMcKee(G));
+	EXPECT_EQ(1u, bandwidth(R));
+	EXPECT_EQ(1u, bandwidth(NodeReordering::relabel(G, NodeReordering::bfsOrder(G, perm[0]))));
+}
+
+TEST_F(NodeReorderingGTest, testRelabel) {
+	for (bool directed : {false, true}) {
+		Graph G(20, true, directed);
+		G.addEdge(0, 5, 2.0);
+		G.addEdge(5, 7, 3.0);
+		G.addEdge(7, 7, 4.0);
+		G.addEdge(19, 0, 5.0);
+		G.addEdge(3, 12, 6.0);
+		G.removeNode(10);
+
+		std::vector<node> newIds = NodeReordering::gorder(G);
+		Graph R = NodeReordering::relabel(G, newIds);
+		EXPECT_EQ(G.numberOfNodes(), R.numberOfNodes());
+		EXPECT_EQ(G.numberOfNodes(), R.upperNodeIdBound());
+		EXPECT_EQ(G.numberOfEdges(), R.numberOfEdges());
+		EXPECT_EQ(G.numberOfSelfLoops(), R.numberOfSelfLoops());
+		EXPECT_EQ(directed, R.isDirected());
+		G.forEdges([&](node u, node v, edgeweight w) {
+			EXPECT_TRUE(R.hasEdge(newIds[u], newIds[v]));
+			EXPECT_EQ(w, R.weight(newIds[u], newIds[v]));
+		});
+		if (directed) {
+			EXPECT_FALSE(R.hasEdge(newIds[5], newIds[0]));
+		}
+		R.forNodes([&](node u) {
+			node previous = 0;
+			R.forNeighborsOf(u, [&](node v) {
+				EXPECT_LE(previous, v);
+				previous = v;
+			});
+		});
+
+		std::vector<node> oldIds = NodeReordering::invert(newIds);
+		R.forEdges([&](node u, node v) {
+			EXPECT_TRUE(G.hasEdge(oldIds[u], oldIds[v]));
+		});
+
+		std::vector<node> broken = newIds;
+		broken[0] = broken[5];
+		EXPECT_THROW(NodeReordering::relabel(G, broken), std::runtime_error);
+	}
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,19 @@
+/*
+ * NodeReorderingGTest.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NODEREORDERINGGTEST_H
+#define NODEREORDERINGGTEST_H
+
+#include <gtest/gtest.h>
+
+namespace NetworKit {
+
+class NodeReorderingGTest: public testing::Test {
+};
+
+} /* namespace NetworKit */
+
+#endif /* NODEREORDERINGGTEST_H */
@@ -6,18 +6,17 @@
  */
 
 #include "AdamicAdarIndex.h"
-#include "NeighborhoodUtility.h"
 
 #include <cmath>
 
 namespace NetworKit {
 
 double AdamicAdarIndex::runImpl(node u, node v) {
-  std::vector<node> commonNeighbors = NeighborhoodUtility::getCommonNeighbors(*G, u, v);
+  const SortedNeighborhoodIndex& neighborhoods = *sortedNeighborhoods;
   double sum = 0;
-  for (node w : commonNeighbors) {
-    sum += 1.0 / std::log(G->degree(w));
-  }
+  neighborhoods.forCommonNeighbors(u, v, [&](node w) {
+    sum += 1.0 / std::log(neighborhoods.degree(w));
+  });
   return sum;
 }
 
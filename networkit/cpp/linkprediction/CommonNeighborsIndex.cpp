@@ -6,12 +6,11 @@
  */
 
 #include "CommonNeighborsIndex.h"
-#include "NeighborhoodUtility.h"
 
 namespace NetworKit {
 
 double CommonNeighborsIndex::runImpl(node u, node v) {
-  return NeighborhoodUtility::getCommonNeighbors(*G, u, v).size();
+  return sortedNeighborhoods->numberOfCommonNeighbors(u, v);
 }
 
 } // namespace NetworKit
\ No newline at end of file
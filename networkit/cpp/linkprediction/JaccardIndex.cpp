@@ -6,16 +6,17 @@
  */
 
 #include "JaccardIndex.h"
-#include "NeighborhoodUtility.h"
 
 namespace NetworKit {
 
 double JaccardIndex::runImpl(node u, node v) {
-  count unionSize = NeighborhoodUtility::getNeighborsUnion(*G, u, v).size();
+  const SortedNeighborhoodIndex& neighborhoods = *sortedNeighborhoods;
+  count common = neighborhoods.numberOfCommonNeighbors(u, v);
+  count unionSize = neighborhoods.degree(u) + neighborhoods.degree(v) - common;
   if (unionSize == 0) {
     return 0;
   }
-  return 1.0 * NeighborhoodUtility::getCommonNeighbors(*G, u, v).size() / unionSize;
+  return 1.0 * common / unionSize;
 }
 
 } // namespace NetworKit
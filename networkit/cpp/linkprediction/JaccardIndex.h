@@ -29,6 +29,10 @@ private:
    */
   double runImpl(node u, node v) override;
 
+  bool usesNeighborhoodIndex() const override {
+    return true;
+  }
+
 public:
   using LinkPredictor::LinkPredictor;
   
@@ -12,23 +12,82 @@
 #include "../auxiliary/Parallel.h"
 
 #include <omp.h>
+#include <queue>
 
 namespace NetworKit {
 
-LinkPredictor::LinkPredictor() : G(nullptr), validCache(false) {
+namespace {
+
+/**
+ * Same order as PredictionsSorter::sortByScore: descending by score and ascending by node-pair on ties.
+ */
+bool ranksHigher(const LinkPredictor::prediction& a, const LinkPredictor::prediction& b) {
+  return (a.second > b.second) || (a.second == b.second && a.first < b.first);
 }
 
-LinkPredictor::LinkPredictor(const Graph& G) : G(&G), validCache(false) {
+typedef std::priority_queue<LinkPredictor::prediction, std::vector<LinkPredictor::prediction>,
+    decltype(&ranksHigher)> BoundedHeap; //!< The worst of the kept predictions is on top
+
+void pushBounded(BoundedHeap& heap, const LinkPredictor::prediction& p, count k) {
+  if (heap.size() < k) {
+    heap.push(p);
+  } else if (ranksHigher(p, heap.top())) {
+    heap.pop();
+    heap.push(p);
+  }
+}
+
+} // namespace
+
+LinkPredictor::LinkPredictor() : G(nullptr), validCache(false), sortedNeighborhoods(nullptr) {
+}
+
+LinkPredictor::LinkPredictor(const Graph& G) : G(&G), validCache(false), sortedNeighborhoods(nullptr) {
 }
 
 void LinkPredictor::setGraph(const Graph& newGraph) {
   G = &newGraph;
   validCache = false;
+  std::atomic_store(&neighborhoodIndex, std::shared_ptr<const SortedNeighborhoodIndex>());
+  sortedNeighborhoods = nullptr;
+}
+
+const SortedNeighborhoodIndex& LinkPredictor::getNeighborhoodIndex() {
+  return *shareNeighborhoodIndex();
+}
+
+void LinkPredictor::setNeighborhoodIndex(std::shared_ptr<const SortedNeighborhoodIndex> index) {
+  std::atomic_store(&neighborhoodIndex, index);
+  sortedNeighborhoods = index.get();
+}
+
+std::shared_ptr<const SortedNeighborhoodIndex> LinkPredictor::shareNeighborhoodIndex() {
+  if (G == nullptr) {
+    throw std::logic_error("Set a graph first.");
+  }
+  std::shared_ptr<const SortedNeighborhoodIndex> index = std::atomic_load(&neighborhoodIndex);
+  if (!index) {
+    // run() may be called from several threads at once, only one of them builds the index
+    #pragma omp critical (LinkPredictorNeighborhoodIndex)
+    {
+      index = std::atomic_load(&neighborhoodIndex);
+      if (!index) {
+        index = std::make_shared<const SortedNeighborhoodIndex>(*G);
+        std::atomic_store(&neighborhoodIndex, index);
+      }
+    }
+  }
+  return index;
 }
 
 std::vector<LinkPredictor::prediction> LinkPredictor::runOn(std::vector<std::pair<node, node>> nodePairs) {
   std::vector<prediction> predictions(nodePairs.size());
   Aux::Parallel::sort(nodePairs.begin(), nodePairs.end());
+  if (usesNeighborhoodIndex() && G != nullptr && sortedNeighborhoods == nullptr) {
+    // resolve the index outside of the parallel loop, so that it is built in parallel and the
+    // scoring threads only read a plain pointer
+    sortedNeighborhoods = &getNeighborhoodIndex();
+  }
   #pragma omp parallel for schedule(dynamic) shared(predictions)
   for (index i = 0; i < nodePairs.size(); ++i) {
     predictions[i] = std::make_pair(nodePairs[i], run(nodePairs[i].first, nodePairs[i].second));
@@ -47,6 +106,9 @@ double LinkPredictor::run(node u, node v) {
     // Default behaviour for self-loops
     return 0;
   }
+  if (usesNeighborhoodIndex() && sortedNeighborhoods == nullptr) {
+    sortedNeighborhoods = &getNeighborhoodIndex();
+  }
   return runImpl(u, v);
 }
 
@@ -63,4 +125,131 @@ std::vector<LinkPredictor::prediction> LinkPredictor::runAll() {
   return runOn(nodePairs);
 }
 
-} // namespace NetworKit
\ No newline at end of file
+template<typename L>
+void LinkPredictor::forScoredCandidateBatches(bool bothDirections, L handle) {
+  if (G == nullptr) {
+    throw std::logic_error("Set a graph first.");
+  } else if (G->isDirected()) {
+    throw std::invalid_argument("Only undirected graphs accepted.");
+  }
+  const int numThreads = omp_get_max_threads();
+  const count batchSize = 256 * numThreads;
+  std::vector<node> nodes = G->nodes();
+  std::vector<std::vector<std::pair<node, node>>> threadCandidates(numThreads);
+  std::vector<std::vector<node>> threadTwoHop(numThreads);
+  std::vector<std::vector<node>> threadNeighbors(numThreads);
+
+  for (index first = 0; first < nodes.size(); first += batchSize) {
+    const index last = std::min(first + batchSize, (index) nodes.size());
+    #pragma omp parallel num_threads(numThreads)
+    {
+      std::vector<std::pair<node, node>>& candidates = threadCandidates[omp_get_thread_num()];
+      std::vector<node>& twoHop = threadTwoHop[omp_get_thread_num()];
+      std::vector<node>& neighbors = threadNeighbors[omp_get_thread_num()];
+      candidates.clear();
+      #pragma omp for schedule(dynamic, 16)
+      for (index i = first; i < last; ++i) {
+        node u = nodes[i];
+        twoHop.clear();
+        neighbors.clear();
+        G->forNeighborsOf(u, [&](node w) {
+          neighbors.push_back(w);
+          G->forNeighborsOf(w, [&](node x) {
+            if (x != u && (bothDirections || x > u)) {
+              twoHop.push_back(x);
+            }
+          });
+        });
+        std::sort(twoHop.begin(), twoHop.end());
+        twoHop.erase(std::unique(twoHop.begin(), twoHop.end()), twoHop.end());
+        std::sort(neighbors.begin(), neighbors.end());
+        // keep the nodes at distance 2 that are not adjacent to u
+        auto neighbor = neighbors.begin();
+        for (node x : twoHop) {
+          while (neighbor != neighbors.end() && *neighbor < x) {
+            ++neighbor;
+          }
+          if (neighbor == neighbors.end() || *neighbor != x) {
+            candidates.push_back(std::make_pair(u, x));
+          }
+        }
+      }
+    }
+
+    std::vector<std::pair<node, node>> batch;
+    for (auto& candidates : threadCandidates) {
+      batch.insert(batch.end(), candidates.begin(), candidates.end());
+    }
+    if (!batch.empty()) {
+      std::vector<prediction> predictions = runOn(std::move(batch));
+      handle(predictions);
+    }
+  }
+}
+
+std::vector<LinkPredictor::prediction> LinkPredictor::runTopK(count k) {
+  if (k == 0) {
+    return std::vector<prediction>();
+  }
+  const int numThreads = omp_get_max_threads();
+  std::vector<BoundedHeap> heaps(numThreads, BoundedHeap(&ranksHigher));
+  forScoredCandidateBatches(false, [&](const std::vector<prediction>& predictions) {
+    #pragma omp parallel num_threads(numThreads)
+    {
+      BoundedHeap& heap = heaps[omp_get_thread_num()];
+      #pragma omp for schedule(static)
+      for (index i = 0; i < predictions.size(); ++i) {
+        pushBounded(heap, predictions[i], k);
+      }
+    }
+  });
+
+  std::vector<prediction> best;
+  best.reserve(k * numThreads);
+  for (BoundedHeap& heap : heaps) {
+    while (!heap.empty()) {
+      best.push_back(heap.top());
+      heap.pop();
+    }
+  }
+  std::sort(best.begin(), best.end(), ranksHigher);
+  if (best.size() > k) {
+    best.resize(k);
+  }
+  return best;
+}
+
+std::vector<LinkPredictor::prediction> LinkPredictor::runTopKPerNode(count k) {
+  std::vector<prediction> best;
+  if (k == 0) {
+    return best;
+  }
+  forScoredCandidateBatches(true, [&](std::vector<prediction>& predictions) {
+    // runOn returns the predictions sorted by node-pair, so every node forms one group
+    std::vector<index> groupStart;
+    for (index i = 0; i < predictions.size(); ++i) {
+      if (i == 0 || predictions[i].first.first != predictions[i - 1].first.first) {
+        groupStart.push_back(i);
+      }
+    }
+    groupStart.push_back(predictions.size());
+    const count groups = groupStart.size() - 1;
+
+    std::vector<index> offset(groups + 1, best.size());
+    for (index g = 0; g < groups; ++g) {
+      offset[g + 1] = offset[g] + std::min(k, groupStart[g + 1] - groupStart[g]);
+    }
+    best.resize(offset[groups]);
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (index g = 0; g < groups; ++g) {
+      auto begin = predictions.begin() + groupStart[g];
+      auto end = predictions.begin() + groupStart[g + 1];
+      auto middle = begin + (offset[g + 1] - offset[g]);
+      std::partial_sort(begin, middle, end, ranksHigher);
+      std::copy(begin, middle, best.begin() + offset[g]);
+    }
+  });
+  return best;
+}
+
+} // namespace NetworKit
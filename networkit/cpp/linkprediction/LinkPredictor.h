@@ -11,6 +11,7 @@
 #include <memory>
 
 #include "../graph/Graph.h"
+#include "SortedNeighborhoodIndex.h"
 
 namespace NetworKit {
 
@@ -34,11 +35,35 @@ private:
    */
   virtual double runImpl(node u, node v) = 0;
 
+  std::shared_ptr<const SortedNeighborhoodIndex> neighborhoodIndex; //!< Built on first use after setGraph
+
+  /**
+   * Generates the unconnected node-pairs at distance 2 for batches of nodes, scores each batch by runOn
+   * and passes the predictions to @a handle, grouped by the first node. Pairs (u, v) with v < u are only
+   * generated if @a bothDirections is set.
+   */
+  template<typename L>
+  void forScoredCandidateBatches(bool bothDirections, L handle);
+
 protected:
   const Graph* G; //!< Graph to operate on
 
   bool validCache; //!< Indicates whether a possibly used cache is valid
 
+  /**
+   * The index of getNeighborhoodIndex(), resolved before scoring by run, runOn and runAll if
+   * usesNeighborhoodIndex() is true, so that runImpl reads it without synchronization.
+   */
+  const SortedNeighborhoodIndex* sortedNeighborhoods;
+
+  /**
+   * Subclasses that score pairs by sortedNeighborhoods return true, so that the index is built
+   * in parallel before runOn and runAll start scoring.
+   */
+  virtual bool usesNeighborhoodIndex() const {
+    return false;
+  }
+
 public:
   LinkPredictor();
 
@@ -59,6 +84,26 @@ public:
    */
   virtual void setGraph(const Graph& newGraph);
 
+  /**
+   * Returns the sorted neighborhoods of the current graph. The index is built once after every
+   * call of setGraph, unless one has been provided by setNeighborhoodIndex. Since it is a copy,
+   * setGraph has to be called again after the graph has been modified.
+   * @return the index of the sorted neighborhoods of the graph
+   */
+  const SortedNeighborhoodIndex& getNeighborhoodIndex();
+
+  /**
+   * Lets this predictor use @a index, e.g. the one of another predictor working on the same graph,
+   * instead of building its own. The index is discarded by the next call of setGraph.
+   * @param index Index of the sorted neighborhoods of the current graph
+   */
+  void setNeighborhoodIndex(std::shared_ptr<const SortedNeighborhoodIndex> index);
+
+  /**
+   * @return the shared index of the sorted neighborhoods of the current graph, see getNeighborhoodIndex
+   */
+  std::shared_ptr<const SortedNeighborhoodIndex> shareNeighborhoodIndex();
+
   /**
    * Returns a score indicating the likelihood of a future link between the given nodes.
    * Prior to calling this method a graph should be provided through the constructor or
@@ -66,6 +111,8 @@ public:
    * There is also no lower or upper bound for scores and the actual range of values depends
    * on the specific link predictor implementation. In case @a u == @a v a 0 is returned.
    * If suitable this method might make use of parallelization to enhance performance.
+   * The first call after setGraph may build the neighborhood index, so concurrent calls should
+   * be preceded by a call of getNeighborhoodIndex or use runOn.
    * @param u First node in graph
    * @param v Second node in graph
    * @return a prediction-score indicating the likelihood of a future link between the given nodes
@@ -91,6 +138,25 @@ public:
    */
   virtual std::vector<prediction> runAll();
 
+  /**
+   * Returns the @a k node-pairs with the highest scores among all unconnected node-pairs at distance 2,
+   * i.e. the pairs that would close a triangle. The candidates are generated on the fly from the
+   * 2-hop neighborhoods of batches of nodes and scored by runOn, and each thread keeps only its best
+   * @a k predictions in a bounded heap. Unlike runAll the memory therefore does not grow with the number
+   * of candidate pairs. Each pair (u, v) is reported once with u < v.
+   * @param k Number of predictions to return
+   * @return the best @a k predictions, sorted as by PredictionsSorter::sortByScore
+   */
+  virtual std::vector<prediction> runTopK(count k);
+
+  /**
+   * Returns for every node u the @a k best node-pairs (u, v) among the unconnected node-pairs at distance 2,
+   * computed batch-wise like runTopK.
+   * @param k Number of predictions per node
+   * @return the predictions grouped by ascending u, every group sorted as by PredictionsSorter::sortByScore
+   */
+  virtual std::vector<prediction> runTopKPerNode(count k);
+
 };
 
 } // namespace NetworKit
@@ -9,30 +9,93 @@
 #include "../auxiliary/Parallel.h"
 
 #include <algorithm>
+#include <omp.h>
 #include <random>
 
 namespace NetworKit {
 
+namespace {
+
+/**
+ * Per-thread state of the breadth-first searches. A node counts as visited if its stamp equals the
+ * stamp of the current search, so nothing has to be reset between two searches.
+ */
+struct SearchWorkspace {
+  std::vector<index> stamps;
+  index currentStamp = 0;
+  std::vector<node> frontier;
+  std::vector<node> nextFrontier;
+};
+
+/**
+ * Calls @a handle(v) for every node v at distance exactly @a k from @a u, using level-synchronous frontiers.
+ */
+template<typename L>
+void forNodesAtDistance(const Graph& G, node u, count k, SearchWorkspace& workspace, L handle) {
+  if (workspace.stamps.size() < G.upperNodeIdBound()) {
+    workspace.stamps.assign(G.upperNodeIdBound(), 0);
+    workspace.currentStamp = 0;
+  }
+  const index stamp = ++workspace.currentStamp;
+  std::vector<node>& frontier = workspace.frontier;
+  std::vector<node>& nextFrontier = workspace.nextFrontier;
+  frontier.clear();
+  frontier.push_back(u);
+  workspace.stamps[u] = stamp;
+  for (count i = 1; i <= k && !frontier.empty(); ++i) {
+    nextFrontier.clear();
+    for (node w : frontier) {
+      G.forNeighborsOf(w, [&](node v) {
+        if (workspace.stamps[v] != stamp) {
+          workspace.stamps[v] = stamp;
+          nextFrontier.push_back(v);
+        }
+      });
+    }
+    std::swap(frontier, nextFrontier);
+  }
+  for (node v : frontier) {
+    handle(v);
+  }
+}
+
+} // namespace
+
 MissingLinksFinder::MissingLinksFinder(const Graph& G) : G(G) {
 }
 
 std::vector<std::pair<node, node>> MissingLinksFinder::findAtDistance(count k) {
-  std::vector<std::pair<node, node>> missingLinks;
   std::vector<node> nodes = G.nodes();
-  #pragma omp parallel
+  const int numThreads = omp_get_max_threads();
+  std::vector<std::vector<std::pair<node, node>>> missingLinksPrivate(numThreads);
+  #pragma omp parallel num_threads(numThreads)
   {
-    std::vector<std::pair<node, node>> missingLinksPrivate;
-    #pragma omp for nowait
+    SearchWorkspace workspace;
+    std::vector<std::pair<node, node>>& missingAtThread = missingLinksPrivate[omp_get_thread_num()];
+    #pragma omp for schedule(dynamic, 64) nowait
     for (index i = 0; i < nodes.size(); ++i) {
-      std::vector<std::pair<node, node>> missingAtU = findFromNode(nodes[i], k);
+      node u = nodes[i];
       // Discard all node-pairs of the form u > v. This removes all duplicates that result from undirected edges.
-      missingAtU.erase(std::remove_if(std::begin(missingAtU), std::end(missingAtU),
-          [&](std::pair<node, node> p) { return p.first >= p.second; }), std::end(missingAtU));
-      missingLinksPrivate.insert(missingLinksPrivate.end(), missingAtU.begin(), missingAtU.end());
+      forNodesAtDistance(G, u, k, workspace, [&](node v) {
+        if (u < v) {
+          missingAtThread.push_back(std::make_pair(u, v));
+        }
+      });
     }
-    #pragma omp critical
-    missingLinks.insert(missingLinks.end(), missingLinksPrivate.begin(), missingLinksPrivate.end());
   }
+
+  // Concatenate the per-thread results at the offsets given by the prefix sums of their sizes
+  std::vector<index> offsets(numThreads + 1, 0);
+  for (int t = 0; t < numThreads; ++t) {
+    offsets[t + 1] = offsets[t] + missingLinksPrivate[t].size();
+  }
+  std::vector<std::pair<node, node>> missingLinks(offsets[numThreads]);
+  #pragma omp parallel for num_threads(numThreads)
+  for (int t = 0; t < numThreads; ++t) {
+    std::copy(missingLinksPrivate[t].begin(), missingLinksPrivate[t].end(), missingLinks.begin() + offsets[t]);
+    std::vector<std::pair<node, node>>().swap(missingLinksPrivate[t]);
+  }
+
   DEBUG("Found ", missingLinks.size(), " missing links with distance ", k, ".");
   Aux::Parallel::sort(missingLinks.begin(), missingLinks.end());
   return missingLinks;
@@ -40,30 +103,11 @@ std::vector<std::pair<node, node>> MissingLinksFinder::findAtDistance(count k) {
 
 std::vector<std::pair<node, node>> MissingLinksFinder::findFromNode(node u, count k) {
   std::vector<std::pair<node, node>> missingLinks;
-  std::vector<bool> visited;
-  visited.resize(G.upperNodeIdBound(), false);
-  std::queue<node> q;
-  q.push(u);
-  visited[u] = true;
-  for (count i = 1; i <= k; ++i) {
-    std::queue<node> newFound;
-    while (!q.empty()) {
-      node u = q.front();
-      q.pop();
-      G.forNeighborsOf(u, [&](node v) {
-        if (!visited[v]) {
-          newFound.push(v);
-          visited[v] = true;
-        }
-      });
-    }
-    q = newFound;
-  }
-  while (!q.empty()) {
-    missingLinks.push_back(std::make_pair(u, q.front()));
-    q.pop();
-  }
+  SearchWorkspace workspace;
+  forNodesAtDistance(G, u, k, workspace, [&](node v) {
+    missingLinks.push_back(std::make_pair(u, v));
+  });
   return missingLinks;
 }
 
-} // namespace NetworKit
\ No newline at end of file
+} // namespace NetworKit
@@ -10,15 +10,22 @@
 namespace NetworKit {
 
 double NeighborsMeasureIndex::runImpl(node u, node v) {
+  const SortedNeighborhoodIndex& neighborhoods = *sortedNeighborhoods;
   double neighborConnections = 0;
-  G->forNeighborsOf(u, [&](node uNeighbor) {
-    G->forNeighborsOf(v, [&](node vNeighbor) {
+  for (const node* uNeighbor = neighborhoods.neighborsBegin(u); uNeighbor != neighborhoods.neighborsEnd(u); ++uNeighbor) {
+    // Count the neighbors of v that equal uNeighbor or are adjacent to it by merging the sorted neighborhoods
+    const node* candidate = neighborhoods.neighborsBegin(*uNeighbor);
+    const node* candidatesEnd = neighborhoods.neighborsEnd(*uNeighbor);
+    for (const node* vNeighbor = neighborhoods.neighborsBegin(v); vNeighbor != neighborhoods.neighborsEnd(v); ++vNeighbor) {
+      while (candidate != candidatesEnd && *candidate < *vNeighbor) {
+        ++candidate;
+      }
       // Don't count self-loops
-      if (uNeighbor == vNeighbor || G->hasEdge(uNeighbor, vNeighbor)) {
+      if (*uNeighbor == *vNeighbor || (candidate != candidatesEnd && *candidate == *vNeighbor)) {
         ++neighborConnections;
       }
-    });
-  }); 
+    }
+  }
   return neighborConnections;
 }
 
@@ -6,16 +6,15 @@
  */
 
 #include "ResourceAllocationIndex.h"
-#include "NeighborhoodUtility.h"
 
 namespace NetworKit {
 
 double ResourceAllocationIndex::runImpl(node u, node v) {
-  std::vector<node> commonNeighbors = NeighborhoodUtility::getCommonNeighbors(*G, u, v);
+  const SortedNeighborhoodIndex& neighborhoods = *sortedNeighborhoods;
   double sum = 0;
-  for (node w : commonNeighbors) {
-    sum += 1.0 / G->degree(w);
-  }
+  neighborhoods.forCommonNeighbors(u, v, [&](node w) {
+    sum += 1.0 / neighborhoods.degree(w);
+  });
   return sum;
 }
 
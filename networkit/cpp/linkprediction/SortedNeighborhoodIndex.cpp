@@ -0,0 +1,36 @@
+/*
+ * SortedNeighborhoodIndex.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "SortedNeighborhoodIndex.h"
+
+namespace NetworKit {
+
+SortedNeighborhoodIndex::SortedNeighborhoodIndex(const Graph& G) : offsets(G.upperNodeIdBound() + 1, 0) {
+  const count z = G.upperNodeIdBound();
+  for (node u = 0; u < z; ++u) {
+    offsets[u + 1] = offsets[u] + (G.hasNode(u) ? G.degree(u) : 0);
+  }
+  neighborIds.resize(offsets[z]);
+
+  G.balancedParallelForNodes([&](node u) {
+    node* neighbors = neighborIds.data() + offsets[u];
+    index i = 0;
+    G.forNeighborsOf(u, [&](node v) {
+      neighbors[i++] = v;
+    });
+    std::sort(neighbors, neighbors + i);
+  });
+}
+
+count SortedNeighborhoodIndex::numberOfCommonNeighbors(node u, node v) const {
+  count common = 0;
+  forCommonNeighbors(u, v, [&](node) {
+    ++common;
+  });
+  return common;
+}
+
+} // namespace NetworKit
@@ -0,0 +1,121 @@
+/*
+ * SortedNeighborhoodIndex.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef SORTEDNEIGHBORHOODINDEX_H_
+#define SORTEDNEIGHBORHOODINDEX_H_
+
+#include <algorithm>
+
+#include "../graph/Graph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup linkprediction
+ *
+ * Immutable copy of the neighborhoods of a graph in which every neighborhood is sorted.
+ * All neighborhoods are stored in one array, so that the set operations needed by the
+ * neighborhood-based link predictors are allocation-free merges. The index is built in
+ * parallel and is shared by all predictors working on the same graph.
+ * Multiple edges are treated as in std::set_intersection and std::set_union.
+ */
+class SortedNeighborhoodIndex {
+public:
+  /**
+   * Builds the index of the neighborhoods of @a G.
+   * @param G The graph
+   */
+  explicit SortedNeighborhoodIndex(const Graph& G);
+
+  /**
+   * @return the degree of @a u
+   */
+  count degree(node u) const {
+    return offsets[u + 1] - offsets[u];
+  }
+
+  /**
+   * @return pointer to the smallest neighbor of @a u
+   */
+  const node* neighborsBegin(node u) const {
+    return neighborIds.data() + offsets[u];
+  }
+
+  /**
+   * @return pointer behind the largest neighbor of @a u
+   */
+  const node* neighborsEnd(node u) const {
+    return neighborIds.data() + offsets[u + 1];
+  }
+
+  /**
+   * @return true if @a v is a neighbor of @a u, found by binary search
+   */
+  bool hasNeighbor(node u, node v) const {
+    return std::binary_search(neighborsBegin(u), neighborsEnd(u), v);
+  }
+
+  /**
+   * Calls @a handle(w) for every common neighbor w of @a u and @a v in ascending order.
+   * If one neighborhood is much smaller than the other, its nodes are searched in the larger one.
+   */
+  template<typename L>
+  void forCommonNeighbors(node u, node v, L handle) const;
+
+  /**
+   * @return the number of common neighbors of @a u and @a v
+   */
+  count numberOfCommonNeighbors(node u, node v) const;
+
+  /**
+   * @return the size of the union of the neighborhoods of @a u and @a v
+   */
+  count neighborsUnionSize(node u, node v) const {
+    return degree(u) + degree(v) - numberOfCommonNeighbors(u, v);
+  }
+
+private:
+  std::vector<index> offsets; //!< The neighbors of u are neighborIds[offsets[u]..offsets[u+1])
+  std::vector<node> neighborIds;
+
+};
+
+template<typename L>
+void SortedNeighborhoodIndex::forCommonNeighbors(node u, node v, L handle) const {
+  const node* small = neighborsBegin(u);
+  const node* smallEnd = neighborsEnd(u);
+  const node* large = neighborsBegin(v);
+  const node* largeEnd = neighborsEnd(v);
+  if (smallEnd - small > largeEnd - large) {
+    std::swap(small, large);
+    std::swap(smallEnd, largeEnd);
+  }
+  if (16 * (smallEnd - small) < largeEnd - large) {
+    for (; small != smallEnd && large != largeEnd; ++small) {
+      large = std::lower_bound(large, largeEnd, *small);
+      if (large != largeEnd && *large == *small) {
+        handle(*small);
+        ++large;
+      }
+    }
+  } else {
+    while (small != smallEnd && large != largeEnd) {
+      if (*small < *large) {
+        ++small;
+      } else if (*large < *small) {
+        ++large;
+      } else {
+        handle(*small);
+        ++small;
+        ++large;
+      }
+    }
+  }
+}
+
+} // namespace NetworKit
+
+#endif /* SORTEDNEIGHBORHOODINDEX_H_ */
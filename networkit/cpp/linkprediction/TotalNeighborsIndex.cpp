@@ -6,12 +6,11 @@
  */
 
 #include "TotalNeighborsIndex.h"
-#include "NeighborhoodUtility.h"
 
 namespace NetworKit {
 
 double TotalNeighborsIndex::runImpl(node u, node v) {
-  return NeighborhoodUtility::getNeighborsUnion(*G, u, v).size();
+  return sortedNeighborhoods->neighborsUnionSize(u, v);
 }
 
 } // namespace NetworKit
@@ -25,6 +25,15 @@
 #include "../NeighborsMeasureIndex.h"
 #include "../SameCommunityIndex.h"
 #include "../PredictionsSorter.h"
+#include "../AdamicAdarIndex.h"
+#include "../ResourceAllocationIndex.h"
+#include "../NeighborhoodUtility.h"
+#include "../SortedNeighborhoodIndex.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+
+#include <cmath>
+#include "../../auxiliary/Random.h"
+#include "../../graph/BFS.h"
 
 namespace NetworKit {
 
@@ -79,6 +88,28 @@ TEST_F(LinkPredictionGTest, testMissingLinksFinderDistanceThree) {
   EXPECT_EQ(0, hopThreeMissingLinks[1].first); EXPECT_EQ(5, hopThreeMissingLinks[1].second);
 }
 
+TEST_F(LinkPredictionGTest, testMissingLinksFinderAgainstBFS) {
+  Aux::Random::setSeed(3, false);
+  ErdosRenyiGenerator generator(150, 0.02);
+  Graph H = generator.generate();
+  H.addNode(); // isolated node
+  MissingLinksFinder finder(H);
+  for (count k = 1; k <= 4; ++k) {
+    std::vector<std::pair<node, node>> expected;
+    H.forNodes([&](node u) {
+      BFS bfs(H, u);
+      bfs.run();
+      std::vector<edgeweight> distances = bfs.getDistances();
+      H.forNodes([&](node v) {
+        if (u < v && distances[v] == k) {
+          expected.push_back(std::make_pair(u, v));
+        }
+      });
+    });
+    EXPECT_EQ(expected, finder.findAtDistance(k));
+  }
+}
+
 TEST_F(LinkPredictionGTest, testLinkThresholderByScore) {
   std::vector<std::pair<node, node>> selectedLinks;
   selectedLinks = LinkThresholder::byScore(predictions, 2);
@@ -188,6 +219,120 @@ TEST_F(LinkPredictionGTest, testKatzRunOnOrdering) {
   }
 }
 
+TEST_F(LinkPredictionGTest, testSortedNeighborhoodIndex) {
+  ErdosRenyiGenerator generator(200, 0.05);
+  Graph H = generator.generate();
+  H.addNode(); // isolated node
+  H.addEdge(7, 7); // self-loop
+  SortedNeighborhoodIndex neighborhoods(H);
+  H.forNodes([&](node u) {
+    EXPECT_EQ(H.degree(u), neighborhoods.degree(u));
+    EXPECT_TRUE(std::is_sorted(neighborhoods.neighborsBegin(u), neighborhoods.neighborsEnd(u)));
+  });
+  H.forNodePairs([&](node u, node v) {
+    std::vector<node> common;
+    neighborhoods.forCommonNeighbors(u, v, [&](node w) {
+      common.push_back(w);
+    });
+    EXPECT_EQ(NeighborhoodUtility::getCommonNeighbors(H, u, v), common);
+    EXPECT_EQ(NeighborhoodUtility::getNeighborsUnion(H, u, v).size(), neighborhoods.neighborsUnionSize(u, v));
+    EXPECT_EQ(H.hasEdge(u, v), neighborhoods.hasNeighbor(u, v));
+  });
+  // a hub against a small neighborhood takes the binary search path
+  Graph star(100);
+  for (node v = 1; v < 100; ++v) {
+    star.addEdge(0, v);
+  }
+  star.addEdge(1, 2);
+  star.addEdge(1, 50);
+  SortedNeighborhoodIndex starNeighborhoods(star);
+  EXPECT_EQ(2u, starNeighborhoods.numberOfCommonNeighbors(0, 1));
+  EXPECT_EQ(2u, starNeighborhoods.numberOfCommonNeighbors(1, 0));
+}
+
+TEST_F(LinkPredictionGTest, testSharedNeighborhoodIndex) {
+  CommonNeighborsIndex commonNeighbors(trainingGraph);
+  AdamicAdarIndex adamicAdar(trainingGraph);
+  ResourceAllocationIndex resourceAllocation(trainingGraph);
+  JaccardIndex jaccard(trainingGraph);
+  std::shared_ptr<const SortedNeighborhoodIndex> shared = commonNeighbors.shareNeighborhoodIndex();
+  adamicAdar.setNeighborhoodIndex(shared);
+  resourceAllocation.setNeighborhoodIndex(shared);
+  jaccard.setNeighborhoodIndex(shared);
+  EXPECT_EQ(shared.get(), &adamicAdar.getNeighborhoodIndex());
+
+  for (auto& p : predictions) {
+    node u = p.first.first;
+    node v = p.first.second;
+    std::vector<node> common = NeighborhoodUtility::getCommonNeighbors(trainingGraph, u, v);
+    double aa = 0;
+    double ra = 0;
+    for (node w : common) {
+      aa += 1.0 / std::log(trainingGraph.degree(w));
+      ra += 1.0 / trainingGraph.degree(w);
+    }
+    EXPECT_EQ(common.size(), commonNeighbors.run(u, v));
+    EXPECT_DOUBLE_EQ(aa, adamicAdar.run(u, v));
+    EXPECT_DOUBLE_EQ(ra, resourceAllocation.run(u, v));
+    EXPECT_DOUBLE_EQ(1.0 * common.size() / NeighborhoodUtility::getNeighborsUnion(trainingGraph, u, v).size(), jaccard.run(u, v));
+  }
+
+  // a new graph gets a new index
+  commonNeighbors.setGraph(G);
+  EXPECT_NE(shared.get(), &commonNeighbors.getNeighborhoodIndex());
+  EXPECT_EQ(NeighborhoodUtility::getCommonNeighbors(G, 2, 4).size(), commonNeighbors.run(2, 4));
+}
+
+TEST_F(LinkPredictionGTest, testRunTopK) {
+  Aux::Random::setSeed(7, false);
+  ErdosRenyiGenerator generator(300, 0.03);
+  Graph H = generator.generate();
+  std::vector<std::pair<node, node>> candidates = MissingLinksFinder(H).findAtDistance(2);
+
+  JaccardIndex jaccard(H);
+  AdamicAdarIndex adamicAdar(H);
+  for (LinkPredictor* predictor : std::vector<LinkPredictor*>{&jaccard, &adamicAdar}) {
+    std::vector<LinkPredictor::prediction> all = predictor->runOn(candidates);
+    PredictionsSorter::sortByScore(all);
+    for (count k : {0, 1, 25, 100000}) {
+      std::vector<LinkPredictor::prediction> expected(all.begin(), all.begin() + std::min(k, (count) all.size()));
+      std::vector<LinkPredictor::prediction> topK = predictor->runTopK(k);
+      ASSERT_EQ(expected.size(), topK.size());
+      for (index i = 0; i < topK.size(); ++i) {
+        EXPECT_EQ(expected[i].first, topK[i].first);
+        EXPECT_DOUBLE_EQ(expected[i].second, topK[i].second);
+      }
+    }
+  }
+
+  // the Katz index scores in per-thread copies through its own runOn
+  KatzIndex katz(H);
+  std::vector<LinkPredictor::prediction> katzTopK = katz.runTopK(25);
+  EXPECT_EQ(25u, katzTopK.size());
+  for (index i = 1; i < katzTopK.size(); ++i) {
+    EXPECT_GE(katzTopK[i - 1].second, katzTopK[i].second);
+    EXPECT_LT(katzTopK[i].first.first, katzTopK[i].first.second);
+  }
+
+  // per node, compared to the predictions of all pairs at distance 2 from each node
+  count k = 3;
+  std::vector<LinkPredictor::prediction> perNode = jaccard.runTopKPerNode(k);
+  index i = 0;
+  H.forNodes([&](node u) {
+    std::vector<std::pair<node, node>> fromU = MissingLinksFinder(H).findFromNode(u, 2);
+    std::vector<LinkPredictor::prediction> expected = jaccard.runOn(fromU);
+    PredictionsSorter::sortByScore(expected);
+    expected.resize(std::min(k, (count) expected.size()));
+    for (auto& p : expected) {
+      ASSERT_LT(i, perNode.size());
+      EXPECT_EQ(p.first, perNode[i].first);
+      EXPECT_DOUBLE_EQ(p.second, perNode[i].second);
+      ++i;
+    }
+  });
+  EXPECT_EQ(i, perNode.size());
+}
+
 } // namespace NetworKit
 
 #endif /* NOGTEST */
\ No newline at end of file
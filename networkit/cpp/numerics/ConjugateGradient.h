@@ -72,34 +72,40 @@ SolverStatus ConjugateGradient<Matrix, Preconditioner>::solve(const Vector& rhs,
 	double sqr_desired_residual = this->tolerance * this->tolerance * (rhs.length() * rhs.length());
 
 	// Main loop. See: http://en.wikipedia.org/wiki/Conjugate_gradient_method#The_resulting_algorithm
-	Vector residual_dir = rhs - matrix*result;
-	Vector conjugate_dir = precond.rhs(residual_dir);
-	double sqr_residual = Vector::innerProduct(residual_dir, residual_dir);
-	double sqr_residual_precond = Vector::innerProduct(residual_dir, conjugate_dir);
+	// The four work vectors are allocated once, all updates inside the loop are in place.
+	Vector tmp(rhs.getDimension());
+	matrix.multiply(result, tmp);
+	Vector residual_dir = rhs;
+	residual_dir -= tmp;
+	Vector residual_precond(rhs.getDimension());
+	precond.rhs(residual_dir, residual_precond);
+	Vector conjugate_dir = residual_precond;
+	double sqr_residual = residual_dir.squaredLength();
+	double sqr_residual_precond = Vector::innerProduct(residual_dir, residual_precond);
 
 	count niters = 0;
-	Vector tmp, residual_precond;
 	while (sqr_residual > sqr_desired_residual) {
 		niters++;
 		if (niters > maxIterations) {
 			break;
 		}
 
-		tmp = matrix * conjugate_dir;
+		matrix.multiply(conjugate_dir, tmp);
 		double step = sqr_residual_precond / Vector::innerProduct(conjugate_dir, tmp);
-		result += step * conjugate_dir;
-		residual_dir -= step * tmp;
-		sqr_residual = Vector::innerProduct(residual_dir, residual_dir);
+		result.axpy(step, conjugate_dir);
+		sqr_residual = residual_dir.axpyAndSquaredLength(-step, tmp);
 
-		residual_precond = precond.rhs(residual_dir);
+		precond.rhs(residual_dir, residual_precond);
 		double new_sqr_residual_precond = Vector::innerProduct(residual_dir, residual_precond);
-		conjugate_dir = (new_sqr_residual_precond / sqr_residual_precond) * conjugate_dir + residual_precond;
+		conjugate_dir.aypx(new_sqr_residual_precond / sqr_residual_precond, residual_precond);
 		sqr_residual_precond = new_sqr_residual_precond;
 	}
 
 	SolverStatus status;
 	status.numIters = niters;
-	status.residual = (rhs - matrix*result).length();
+	matrix.multiply(result, tmp);
+	tmp -= rhs;
+	status.residual = tmp.length();
 	status.converged = status.residual / rhs.length() <= this->tolerance;
 
 	return status;
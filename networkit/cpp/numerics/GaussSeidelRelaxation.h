@@ -56,16 +56,20 @@ public:
 template<class Matrix>
 Vector GaussSeidelRelaxation<Matrix>::relax(const Matrix& A, const Vector& b, const Vector& initialGuess, const count maxIterations) const {
 	count iterations = 0;
-	Vector x_old = initialGuess;
 	Vector x_new = initialGuess;
 	if (maxIterations == 0) return initialGuess;
 
 	count dimension = A.numberOfColumns();
 	Vector diagonal = A.diagonal();
+	Vector residual; // reused by the stopping criterion
+	const double bound = tolerance * b.length();
+	auto converged = [&]() {
+		A.multiply(x_new, residual);
+		residual -= b;
+		return residual.length() <= bound;
+	};
 
 	do {
-		x_old = x_new;
-
 		for (index i = 0; i < dimension; ++i) {
 			double sigma = 0.0;
 			A.forNonZeroElementsInRow(i, [&](index column, double value) {
@@ -78,7 +82,7 @@ Vector GaussSeidelRelaxation<Matrix>::relax(const Matrix& A, const Vector& b, co
 		}
 
 		iterations++;
-	} while (iterations < maxIterations && (A*x_new - b).length() / b.length() > tolerance);
+	} while (iterations < maxIterations && !converged());
 
 	return x_new;
 }
@@ -0,0 +1,94 @@
+/*
+ * JacobiRelaxation.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef JACOBIRELAXATION_H_
+#define JACOBIRELAXATION_H_
+
+#include "Smoother.h"
+
+#include <cmath>
+
+namespace NetworKit {
+
+/**
+ * @ingroup numerics
+ * Implementation of the (weighted) Jacobi smoother. In contrast to Gauss-Seidel every component of
+ * an iteration only depends on the previous iterate, so the rows are relaxed in parallel.
+ */
+template<class Matrix>
+class JacobiRelaxation : public Smoother<Matrix> {
+private:
+	double omega;
+	double tolerance;
+
+public:
+	/**
+	 * Constructs a Jacobi smoother with damping factor @a omega (default: 2/3) and the given @a tolerance (default: 1e-15).
+	 * @param omega
+	 * @param tolerance
+	 */
+	JacobiRelaxation(double omega=2.0/3.0, double tolerance=1e-15) : omega(omega), tolerance(tolerance) {}
+
+	/**
+	 * Utilizes Jacobi relaxations until the given number of @a maxIterations is reached or the relative residual
+	 * is below the tolerance specified in the constructor. The solver starts with @a initialGuess as intitial guess to
+	 * the solution.
+	 * @param A The matrix.
+	 * @param b The right-hand-side.
+	 * @param initialGuess
+	 * @param maxIterations
+	 * @return The (approximate) solution to the system.
+	 */
+	Vector relax(const Matrix& A, const Vector& b, const Vector& initialGuess, const count maxIterations = std::numeric_limits<count>::max()) const;
+
+	/**
+	 * Utilizes Jacobi relaxations until the given number of @a maxIterations is reached or the relative residual
+	 * is below the tolerance specified in the constructor.
+	 * @param A The matrix.
+	 * @param b The right-hand-side.
+	 * @param maxIterations
+	 * @return The (approximate) solution to the system.
+	 */
+	Vector relax(const Matrix& A, const Vector& b, const count maxIterations = std::numeric_limits<count>::max()) const;
+};
+
+template<class Matrix>
+Vector JacobiRelaxation<Matrix>::relax(const Matrix& A, const Vector& b, const Vector& initialGuess, const count maxIterations) const {
+	Vector x_old = initialGuess;
+	Vector x_new = initialGuess;
+	count dimension = A.numberOfColumns();
+	Vector diagonal = A.diagonal();
+	double bound = tolerance * b.length();
+
+	for (count iterations = 0; iterations < maxIterations; ++iterations) {
+		// the residual of x_old falls out of the sweep, so no extra product is needed for the stopping criterion
+		double residualSqr = 0.0;
+#pragma omp parallel for reduction(+:residualSqr)
+		for (index i = 0; i < dimension; ++i) {
+			double r = b[i];
+			A.forNonZeroElementsInRow(i, [&](index column, double value) {
+				r -= value * x_old[column];
+			});
+			residualSqr += r * r;
+			x_new[i] = x_old[i] + omega * r / diagonal[i];
+		}
+
+		if (std::sqrt(residualSqr) <= bound) break;
+		std::swap(x_old, x_new);
+	}
+
+	return x_old;
+}
+
+template<class Matrix>
+Vector JacobiRelaxation<Matrix>::relax(const Matrix& A, const Vector& b, const count maxIterations) const {
+	Vector x(b.getDimension());
+	return relax(A, b, x, maxIterations);
+}
+
+} /* namespace NetworKit */
+
+#endif /* JACOBIRELAXATION_H_ */
@@ -9,6 +9,12 @@
 #define NETWORKIT_CPP_NUMERICS_LAMG_LAMG_H_
 
 #include <vector>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <fstream>
+#include <algorithm>
+#include <cstring>
 
 #include "../LinearSolver.h"
 #include "MultiLevelSetup.h"
@@ -20,39 +26,77 @@
 
 namespace NetworKit {
 
+namespace LAMGBinaryIO {
+const char setupFileCookie[8] = {'N', 'K', 'L', 'A', 'M', 'G', '0', '1'};
+} /* namespace LAMGBinaryIO */
+
 /**
  * @ingroup numerics
  * Represents the interface to the Lean Algebraic Multigrid (LAMG) graph Laplacian linear solver
  * by Oren E. Livne and Achi Brandt.
  * @see Livne, Oren E., and Achi Brandt. "Lean algebraic multigrid (LAMG): Fast graph Laplacian linear solver." SIAM Journal on Scientific Computing 34.4 (2012): B499-B522.
+ * The smoother used on all levels is selected by @a SmootherType and defaults to Gauss-Seidel relaxation.
  */
-template<class Matrix>
+template<class Matrix, class SmootherType = GaussSeidelRelaxation<Matrix>>
 class Lamg : public LinearSolver<Matrix> {
 private:
 	bool validSetup;
-	GaussSeidelRelaxation<Matrix> smoother;
+	SmootherType smoother;
 	MultiLevelSetup<Matrix> lamgSetup;
 	Matrix laplacianMatrix;
 	std::vector<LevelHierarchy<Matrix>> compHierarchies;
 	std::vector<SolverLamg<Matrix>> compSolvers;
-	std::vector<LAMGSolverStatus> compStati;
-
-	std::vector<Vector> initialVectors;
-	std::vector<Vector> rhsVectors;
 
 	count numComponents;
 	std::vector<std::vector<index>> components;
 	std::vector<index> graph2Components;
 
 	void initializeForOneComponent();
+	void createSolvers();
+
+	/**
+	 * Setup of a Laplacian as stored in the process-wide setup cache.
+	 */
+	struct CachedSetup {
+		uint64_t fingerprint;
+		bool componentsKnown; // false if created by setupConnected
+		Matrix laplacianMatrix;
+		count numComponents;
+		std::vector<std::vector<index>> components;
+		std::vector<index> graph2Components;
+		std::vector<LevelHierarchy<Matrix>> compHierarchies;
+	};
+
+	struct SetupCache {
+		std::mutex mutex;
+		count capacity = 0;
+		std::list<std::shared_ptr<const CachedSetup>> entries; // most recently used first
+	};
+
+	static SetupCache& setupCache() {
+		static SetupCache cache;
+		return cache;
+	}
+
+	static uint64_t fingerprint(const Matrix& matrix);
+	static bool sameMatrix(const Matrix& A, const Matrix& B);
+	bool restoreFromCache(const Matrix& laplacianMatrix, bool needComponents);
+	void storeInCache(bool componentsKnown) const;
+
+	/**
+	 * Solves the system with the given solver instances (one per component). All state of a running solve lives in
+	 * the solver instances and local variables, so concurrent calls with distinct @a solvers are safe.
+	 */
+	SolverStatus solveWith(std::vector<SolverLamg<Matrix>>& solvers, const Vector& rhs, Vector& result, count maxConvergenceTime, count maxIterations);
 
 public:
 	/**
 	 * Construct a solver with the given @a tolerance. The relative residual ||Ax-b||/||b|| will be less than or equal to
-	 * @a tolerance after the solver finished.
+	 * @a tolerance after the solver finished. The @a smoother is used for relaxing during setup and solve.
 	 * @param tolerance
+	 * @param smoother
 	 */
-	Lamg(const double tolerance = 1e-6) : LinearSolver<Matrix>(tolerance), validSetup(false), lamgSetup(smoother), numComponents(0) {}
+	Lamg(const double tolerance = 1e-6, const SmootherType& smoother = SmootherType()) : LinearSolver<Matrix>(tolerance), validSetup(false), smoother(smoother), lamgSetup(this->smoother), numComponents(0) {}
 	/** Default destructor */
 	~Lamg() = default;
 
@@ -86,7 +130,8 @@ public:
 	/**
 	 * Compute the @a results for the matrix currently setup and the right-hand sides @a rhs.
 	 * The maximum spent time for each system can be specified by @a maxConvergenceTime and the maximum number of iterations can be set
-	 * by @a maxIterations.
+	 * by @a maxIterations. The systems are solved in parallel and share the hierarchy computed during setup, so this
+	 * should be preferred over repeated calls to @ref solve whenever several right-hand sides are known in advance.
 	 * @param rhs
 	 * @param results
 	 * @param maxConvergenceTime
@@ -94,26 +139,61 @@ public:
 	 */
 	void parallelSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime = 5 * 60 * 1000, count maxIterations = std::numeric_limits<count>::max());
 
+	/**
+	 * Writes the current setup (Laplacian, components and the multigrid hierarchy of every component) in a binary
+	 * format to @a path, so that a later process can skip the setup phase by calling @ref loadSetup.
+	 * @param path
+	 */
+	void saveSetup(const std::string& path) const;
+
+	/**
+	 * Replaces the current setup by the one written to @a path by @ref saveSetup.
+	 * @param path
+	 */
+	void loadSetup(const std::string& path);
+
+	/**
+	 * Sets the number of setups kept in the process-wide setup cache. While the capacity is positive, @ref setup and
+	 * @ref setupConnected reuse the hierarchy of an earlier setup of an identical Laplacian instead of computing it again.
+	 * The least recently used setups are evicted first. The cache is disabled (capacity 0) by default.
+	 * @param capacity
+	 */
+	static void setSetupCacheCapacity(count capacity);
+
+	/**
+	 * Removes all setups from the process-wide setup cache.
+	 */
+	static void clearSetupCache();
 };
 
-template<class Matrix>
-void Lamg<Matrix>::initializeForOneComponent() {
+template<class Matrix, class SmootherType>
+void Lamg<Matrix, SmootherType>::initializeForOneComponent() {
 	compHierarchies = std::vector<LevelHierarchy<Matrix>>(1);
 	lamgSetup.setup(laplacianMatrix, compHierarchies[0]);
+	createSolvers();
+}
+
+template<class Matrix, class SmootherType>
+void Lamg<Matrix, SmootherType>::createSolvers() {
 	compSolvers.clear();
-	compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[0], smoother));
+	for (index i = 0; i < compHierarchies.size(); ++i) {
+		compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[i], smoother));
+	}
 	validSetup = true;
 }
 
-template<class Matrix>
-void Lamg<Matrix>::setupConnected(const Matrix& laplacianMatrix) {
+template<class Matrix, class SmootherType>
+void Lamg<Matrix, SmootherType>::setupConnected(const Matrix& laplacianMatrix) {
+	if (restoreFromCache(laplacianMatrix, false)) return;
 	this->laplacianMatrix = laplacianMatrix;
 	initializeForOneComponent();
 	numComponents = 1;
+	storeInCache(false);
 }
 
-template<class Matrix>
-void Lamg<Matrix>::setup(const Matrix& laplacianMatrix) {
+template<class Matrix, class SmootherType>
+void Lamg<Matrix, SmootherType>::setup(const Matrix& laplacianMatrix) {
+	if (restoreFromCache(laplacianMatrix, true)) return;
 	this->laplacianMatrix = laplacianMatrix;
 	Graph G = MatrixTools::matrixToGraph(laplacianMatrix);
 	ParallelConnectedComponents con(G, false);
@@ -124,13 +204,9 @@ void Lamg<Matrix>::setup(const Matrix& laplacianMatrix) {
 	} else {
 		graph2Components = std::vector<index>(G.numberOfNodes());
 
-		initialVectors = std::vector<Vector>(numComponents);
-		rhsVectors = std::vector<Vector>(numComponents);
-
 		components = std::vector<std::vector<index>>(numComponents);
 		compHierarchies = std::vector<LevelHierarchy<Matrix>>(numComponents);
 		compSolvers.clear();
-		compStati = std::vector<LAMGSolverStatus>(numComponents);
 
 		// create solver for every component
 		index compIdx = 0;
@@ -151,28 +227,29 @@ void Lamg<Matrix>::setup(const Matrix& laplacianMatrix) {
 			}
 
 			Matrix compMatrix(component.size(), component.size(), triplets);
-			initialVectors[compIdx] = Vector(component.size());
-			rhsVectors[compIdx] = Vector(component.size());
 			lamgSetup.setup(compMatrix, compHierarchies[compIdx]);
-			compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[compIdx], smoother));
-			LAMGSolverStatus status;
-			status.desiredResidualReduction = this->tolerance * component.size() / G.numberOfNodes();
-			compStati[compIdx] = status;
 
 			compIdx++;
 		}
 
-		validSetup = true;
+		createSolvers();
 	}
+
+	storeInCache(true);
 }
 
-template<class Matrix>
-SolverStatus Lamg<Matrix>::solve(const Vector& rhs, Vector& result, count maxConvergenceTime, count maxIterations) {
+template<class Matrix, class SmootherType>
+SolverStatus Lamg<Matrix, SmootherType>::solve(const Vector& rhs, Vector& result, count maxConvergenceTime, count maxIterations) {
 	if (!validSetup || result.getDimension() != laplacianMatrix.numberOfColumns()
 			|| rhs.getDimension() != laplacianMatrix.numberOfRows()) {
 		throw std::runtime_error("No or wrong matrix is setup for given vectors.");
 	}
 
+	return solveWith(compSolvers, rhs, result, maxConvergenceTime, maxIterations);
+}
+
+template<class Matrix, class SmootherType>
+SolverStatus Lamg<Matrix, SmootherType>::solveWith(std::vector<SolverLamg<Matrix>>& solvers, const Vector& rhs, Vector& result, count maxConvergenceTime, count maxIterations) {
 	SolverStatus status;
 
 	if (numComponents == 1) {
@@ -180,7 +257,7 @@ SolverStatus Lamg<Matrix>::solve(const Vector& rhs, Vector& result, count maxCon
 		stat.desiredResidualReduction = this->tolerance * rhs.length() / (laplacianMatrix * result - rhs).length();
 		stat.maxIters = maxIterations;
 		stat.maxConvergenceTime = maxConvergenceTime;
-		compSolvers[0].solve(result, rhs, stat);
+		solvers[0].solve(result, rhs, stat);
 
 		status.residual = stat.residual;
 		status.numIters = stat.numIters;
@@ -189,59 +266,243 @@ SolverStatus Lamg<Matrix>::solve(const Vector& rhs, Vector& result, count maxCon
 		// solve on every component
 		count maxIters = 0;
 		for (index i = 0; i < components.size(); ++i) {
+			Vector initialVector(components[i].size());
+			Vector rhsVector(components[i].size());
 			for (auto element : components[i]) {
-				initialVectors[i][graph2Components[element]] = result[element];
-				rhsVectors[i][graph2Components[element]] = rhs[element];
+				initialVector[graph2Components[element]] = result[element];
+				rhsVector[graph2Components[element]] = rhs[element];
 			}
 
-			double resReduction = this->tolerance * rhsVectors[i].length() / (compHierarchies[i].at(0).getLaplacian() * initialVectors[i] - rhsVectors[i]).length();
-			compStati[i].desiredResidualReduction = resReduction * components[i].size() / laplacianMatrix.numberOfRows();
-			compStati[i].maxIters = maxIterations;
-			compStati[i].maxConvergenceTime = maxConvergenceTime;
-			compSolvers[i].solve(initialVectors[i], rhsVectors[i], compStati[i]);
+			LAMGSolverStatus stat;
+			double resReduction = this->tolerance * rhsVector.length() / (compHierarchies[i].at(0).getLaplacian() * initialVector - rhsVector).length();
+			stat.desiredResidualReduction = resReduction * components[i].size() / laplacianMatrix.numberOfRows();
+			stat.maxIters = maxIterations;
+			stat.maxConvergenceTime = maxConvergenceTime;
+			solvers[i].solve(initialVector, rhsVector, stat);
 
 			for (auto element : components[i]) { // write solution back to result
-				result[element] = initialVectors[i][graph2Components[element]];
+				result[element] = initialVector[graph2Components[element]];
 			}
 
-			maxIters = std::max(maxIters, compStati[i].numIters);
+			maxIters = std::max(maxIters, stat.numIters);
 		}
 
 		status.residual = (rhs - laplacianMatrix * result).length();
-		status.converged = status.residual <= this->tolerance;
+		status.converged = status.residual <= this->tolerance * rhs.length();
 		status.numIters = maxIters;
 	}
 
 	return status;
 }
 
-template<class Matrix>
-void Lamg<Matrix>::parallelSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime, count maxIterations) {
-	if (numComponents == 1) {
-		assert(rhs.size() == results.size());
-		const index numThreads = omp_get_max_threads();
-		if (compSolvers.size() != numThreads) {
-			compSolvers.clear();
+template<class Matrix, class SmootherType>
+void Lamg<Matrix, SmootherType>::parallelSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime, count maxIterations) {
+	if (rhs.size() != results.size()) {
+		throw std::runtime_error("Number of right-hand sides and result vectors differ.");
+	}
+	if (!validSetup) {
+		throw std::runtime_error("No or wrong matrix is setup for given vectors.");
+	}
+	for (index i = 0; i < rhs.size(); ++i) {
+		if (results[i].getDimension() != laplacianMatrix.numberOfColumns() || rhs[i].getDimension() != laplacianMatrix.numberOfRows()) {
+			throw std::runtime_error("No or wrong matrix is setup for given vectors.");
+		}
+	}
+
+	if (rhs.size() == 1) { // a single system uses the parallelism inside the cycle instead
+		solve(rhs[0], results[0], maxConvergenceTime, maxIterations);
+		return;
+	}
+
+	// the hierarchies are shared, every thread gets its own solver instances for the per-solve state
+	const count numThreads = std::min((count) omp_get_max_threads(), (count) rhs.size());
+	std::vector<std::vector<SolverLamg<Matrix>>> threadSolvers(numThreads, compSolvers);
+
+	bool nested = omp_get_nested();
+	if (nested) omp_set_nested(false);
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(numThreads)
+	for (index i = 0; i < rhs.size(); ++i) {
+		solveWith(threadSolvers[omp_get_thread_num()], rhs[i], results[i], maxConvergenceTime, maxIterations);
+	}
 
-			for (index i = 0; i < (index) numThreads; ++i) {
-				compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[0], smoother));
+	if (nested) omp_set_nested(true);
+}
+
+template<class Matrix, class SmootherType>
+void Lamg<Matrix, SmootherType>::saveSetup(const std::string& path) const {
+	using namespace LAMGBinaryIO;
+	if (!validSetup) {
+		throw std::runtime_error("No matrix is setup.");
+	}
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	if (!out.is_open()) {
+		throw std::runtime_error("LAMG setup file could not be opened: " + path);
+	}
+
+	out.write(setupFileCookie, sizeof(setupFileCookie));
+	writeMatrix(out, laplacianMatrix);
+	write<uint64_t>(out, numComponents);
+	write<uint64_t>(out, components.size());
+	for (const std::vector<index>& component : components) {
+		writeArray(out, component);
+	}
+	writeArray(out, graph2Components);
+	write<uint64_t>(out, compHierarchies.size());
+	for (const LevelHierarchy<Matrix>& hierarchy : compHierarchies) {
+		hierarchy.writeBinary(out);
+	}
+
+	out.close();
+	if (out.fail()) {
+		throw std::runtime_error("error while writing LAMG setup file: " + path);
+	}
+}
+
+template<class Matrix, class SmootherType>
+void Lamg<Matrix, SmootherType>::loadSetup(const std::string& path) {
+	using namespace LAMGBinaryIO;
+	std::ifstream in(path, std::ios::binary);
+	if (!in.is_open()) {
+		throw std::runtime_error("LAMG setup file could not be opened: " + path);
+	}
+	char found[sizeof(setupFileCookie)];
+	in.read(found, sizeof(found));
+	if (!in || !std::equal(found, found + sizeof(found), setupFileCookie)) {
+		throw std::runtime_error("not a LAMG setup file: " + path);
+	}
+
+	validSetup = false;
+	laplacianMatrix = readMatrix<Matrix>(in);
+	numComponents = read<uint64_t>(in);
+	components = std::vector<std::vector<index>>(read<uint64_t>(in));
+	for (std::vector<index>& component : components) {
+		component = readArray<index>(in);
+	}
+	graph2Components = readArray<index>(in);
+	compHierarchies = std::vector<LevelHierarchy<Matrix>>(read<uint64_t>(in));
+	for (LevelHierarchy<Matrix>& hierarchy : compHierarchies) {
+		hierarchy.readBinary(in);
+	}
+	if (compHierarchies.size() != numComponents || (numComponents > 1 && components.size() != numComponents)) {
+		throw std::runtime_error("corrupt LAMG setup file: " + path);
+	}
+
+	createSolvers();
+}
+
+template<class Matrix, class SmootherType>
+void Lamg<Matrix, SmootherType>::setSetupCacheCapacity(count capacity) {
+	SetupCache& cache = setupCache();
+	std::lock_guard<std::mutex> lock(cache.mutex);
+	cache.capacity = capacity;
+	if (cache.entries.size() > capacity) {
+		cache.entries.resize(capacity);
+	}
+}
+
+template<class Matrix, class SmootherType>
+void Lamg<Matrix, SmootherType>::clearSetupCache() {
+	SetupCache& cache = setupCache();
+	std::lock_guard<std::mutex> lock(cache.mutex);
+	cache.entries.clear();
+}
+
+template<class Matrix, class SmootherType>
+uint64_t Lamg<Matrix, SmootherType>::fingerprint(const Matrix& matrix) {
+	// sum of per-entry hashes, so that the column order within a row does not matter
+	uint64_t hash = 0;
+#pragma omp parallel for reduction(+:hash)
+	for (index i = 0; i < matrix.numberOfRows(); ++i) {
+		matrix.forNonZeroElementsInRow(i, [&](index j, double value) {
+			uint64_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			uint64_t h = (i * 0x9E3779B97F4A7C15ULL) ^ (j * 0xC2B2AE3D27D4EB4FULL) ^ bits;
+			h ^= h >> 31;
+			h *= 0xBF58476D1CE4E5B9ULL;
+			h ^= h >> 29;
+			hash += h;
+		});
+	}
+	return hash ^ matrix.numberOfRows();
+}
+
+template<class Matrix, class SmootherType>
+bool Lamg<Matrix, SmootherType>::sameMatrix(const Matrix& A, const Matrix& B) {
+	if (A.numberOfRows() != B.numberOfRows() || A.numberOfColumns() != B.numberOfColumns() || A.nnz() != B.nnz()) {
+		return false;
+	}
+
+	bool same = true;
+#pragma omp parallel for reduction(&&:same)
+	for (index i = 0; i < A.numberOfRows(); ++i) {
+		std::vector<std::pair<index, double>> rowA;
+		std::vector<std::pair<index, double>> rowB;
+		A.forNonZeroElementsInRow(i, [&](index j, double value) {
+			rowA.emplace_back(j, value);
+		});
+		B.forNonZeroElementsInRow(i, [&](index j, double value) {
+			rowB.emplace_back(j, value);
+		});
+		std::sort(rowA.begin(), rowA.end());
+		std::sort(rowB.begin(), rowB.end());
+		same = same && rowA == rowB;
+	}
+	return same;
+}
+
+template<class Matrix, class SmootherType>
+bool Lamg<Matrix, SmootherType>::restoreFromCache(const Matrix& laplacianMatrix, bool needComponents) {
+	SetupCache& cache = setupCache();
+	{
+		std::lock_guard<std::mutex> lock(cache.mutex);
+		if (cache.capacity == 0 || cache.entries.empty()) return false;
+	}
+
+	uint64_t hash = fingerprint(laplacianMatrix);
+	std::shared_ptr<const CachedSetup> entry;
+	{
+		std::lock_guard<std::mutex> lock(cache.mutex);
+		for (auto it = cache.entries.begin(); it != cache.entries.end(); ++it) {
+			if ((*it)->fingerprint == hash && ((*it)->componentsKnown || !needComponents)) {
+				entry = *it;
+				cache.entries.splice(cache.entries.begin(), cache.entries, it);
+				break;
 			}
 		}
+	}
+	if (!entry || !sameMatrix(entry->laplacianMatrix, laplacianMatrix)) return false;
 
-		bool nested = omp_get_nested();
-		if (nested) omp_set_nested(false);
+	this->laplacianMatrix = laplacianMatrix;
+	numComponents = entry->numComponents;
+	components = entry->components;
+	graph2Components = entry->graph2Components;
+	compHierarchies = entry->compHierarchies;
+	createSolvers();
+	return true;
+}
 
-#pragma omp parallel for
-		for (index i = 0; i < rhs.size(); ++i) {
-			index threadId = omp_get_thread_num();
-			LAMGSolverStatus stat;
-			stat.desiredResidualReduction = this->tolerance * rhs[i].length() / (laplacianMatrix * results[i] - rhs[i]).length();
-			stat.maxIters = maxIterations;
-			stat.maxConvergenceTime = maxConvergenceTime;
-			compSolvers[threadId].solve(results[i], rhs[i], stat);
-		}
+template<class Matrix, class SmootherType>
+void Lamg<Matrix, SmootherType>::storeInCache(bool componentsKnown) const {
+	SetupCache& cache = setupCache();
+	{
+		std::lock_guard<std::mutex> lock(cache.mutex);
+		if (cache.capacity == 0) return;
+	}
 
-		if (nested) omp_set_nested(true);
+	std::shared_ptr<CachedSetup> entry = std::make_shared<CachedSetup>();
+	entry->fingerprint = fingerprint(laplacianMatrix);
+	entry->componentsKnown = componentsKnown;
+	entry->laplacianMatrix = laplacianMatrix;
+	entry->numComponents = numComponents;
+	entry->components = components;
+	entry->graph2Components = graph2Components;
+	entry->compHierarchies = compHierarchies;
+
+	std::lock_guard<std::mutex> lock(cache.mutex);
+	cache.entries.push_front(entry);
+	if (cache.entries.size() > cache.capacity) {
+		cache.entries.resize(cache.capacity);
 	}
 }
 
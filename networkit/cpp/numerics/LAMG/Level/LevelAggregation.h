@@ -29,6 +29,14 @@ public:
 	void restrict(const Vector& bf, Vector& bc) const;
 
 	void interpolate(const Vector& xc, Vector& xf) const;
+
+	inline const Matrix& getP() const {
+		return P;
+	}
+
+	inline const Matrix& getR() const {
+		return R;
+	}
 };
 
 template<class Matrix>
@@ -30,6 +30,10 @@ public:
 	void coarseType(const Vector& xf, Vector& xc) const;
 	void restrict(const Vector& bf, Vector& bc, std::vector<Vector>& bStages) const;
 	void interpolate(const Vector& xc, Vector& xf, const std::vector<Vector>& bStages) const;
+
+	inline const std::vector<EliminationStage<Matrix>>& getCoarseningStages() const {
+		return coarseningStages;
+	}
 };
 
 template<class Matrix>
@@ -37,14 +41,12 @@ LevelElimination<Matrix>::LevelElimination(const Matrix& A, const std::vector<El
 	cIndexFine = std::vector<index>(this->A.numberOfRows());
 #pragma omp parallel for
 	for (index i = 0; i < cIndexFine.size(); ++i) {
-		cIndexFine[i] = i;
-	}
-
-	for (index k = coarseningStages.size(); k-- > 0;) {
-		for (index i = 0; i < cIndexFine.size(); ++i) {
-			assert(cIndexFine[i] < coarseningStages[k].getCSet().size());
-			cIndexFine[i] = coarseningStages[k].getCSet()[cIndexFine[i]];
+		index fine = i;
+		for (index k = coarseningStages.size(); k-- > 0;) {
+			assert(fine < coarseningStages[k].getCSet().size());
+			fine = coarseningStages[k].getCSet()[fine];
 		}
+		cIndexFine[i] = fine;
 	}
 }
 
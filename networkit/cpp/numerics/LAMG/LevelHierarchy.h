@@ -15,8 +15,107 @@
 #include "LAMGSettings.h"
 #include "../../algebraic/DenseMatrix.h"
 
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
 namespace NetworKit {
 
+/**
+ * Helpers for the binary format of LAMG hierarchies. Values are written in native byte order.
+ */
+namespace LAMGBinaryIO {
+
+template<typename T>
+inline void write(std::ostream& out, const T& value) {
+	static_assert(std::is_trivially_copyable<T>::value, "only plain values can be written");
+	out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+inline T read(std::istream& in) {
+	T value;
+	in.read(reinterpret_cast<char*>(&value), sizeof(T));
+	if (!in) {
+		throw std::runtime_error("unexpected end of LAMG hierarchy data");
+	}
+	return value;
+}
+
+template<typename T>
+inline void writeArray(std::ostream& out, const std::vector<T>& values) {
+	write<uint64_t>(out, values.size());
+	out.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+template<typename T>
+inline std::vector<T> readArray(std::istream& in) {
+	std::vector<T> values(read<uint64_t>(in));
+	in.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+	if (!in) {
+		throw std::runtime_error("unexpected end of LAMG hierarchy data");
+	}
+	return values;
+}
+
+inline void writeVector(std::ostream& out, const Vector& v) {
+	write<uint64_t>(out, v.getDimension());
+	for (index i = 0; i < v.getDimension(); ++i) {
+		write<double>(out, v[i]);
+	}
+}
+
+inline Vector readVector(std::istream& in) {
+	Vector v(read<uint64_t>(in));
+	for (index i = 0; i < v.getDimension(); ++i) {
+		v[i] = read<double>(in);
+	}
+	return v;
+}
+
+/** Writes the shape of @a A followed by its non-zeros as separate row, column and value arrays in row order. */
+template<class Matrix>
+void writeMatrix(std::ostream& out, const Matrix& A) {
+	std::vector<index> rows, columns;
+	std::vector<double> values;
+	rows.reserve(A.nnz());
+	columns.reserve(A.nnz());
+	values.reserve(A.nnz());
+	A.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+		rows.push_back(i);
+		columns.push_back(j);
+		values.push_back(value);
+	});
+	write<uint64_t>(out, A.numberOfRows());
+	write<uint64_t>(out, A.numberOfColumns());
+	writeArray(out, rows);
+	writeArray(out, columns);
+	writeArray(out, values);
+}
+
+template<class Matrix>
+Matrix readMatrix(std::istream& in) {
+	count nRows = read<uint64_t>(in);
+	count nCols = read<uint64_t>(in);
+	std::vector<index> rows = readArray<index>(in);
+	std::vector<index> columns = readArray<index>(in);
+	std::vector<double> values = readArray<double>(in);
+	if (rows.size() != columns.size() || rows.size() != values.size()) {
+		throw std::runtime_error("corrupt matrix in LAMG hierarchy data");
+	}
+	std::vector<Triplet> triplets(rows.size());
+	for (index k = 0; k < rows.size(); ++k) {
+		if (rows[k] >= nRows || columns[k] >= nCols) {
+			throw std::runtime_error("corrupt matrix in LAMG hierarchy data");
+		}
+		triplets[k] = {rows[k], columns[k], values[k]};
+	}
+	return Matrix(nRows, nCols, triplets);
+}
+
+} /* namespace LAMGBinaryIO */
+
 /**
  * @ingroup numerics
  */
@@ -50,6 +149,17 @@ public:
 	LevelType getType(index levelIdx) const;
 	Level<Matrix>& at(index levelIdx);
 	double cycleIndex(index levelIdx);
+
+	/**
+	 * Writes the hierarchy in binary form to @a out: the Laplacian of every level, the interpolation and restriction
+	 * operators of the aggregation levels, the elimination stages and the factorized coarsest system.
+	 */
+	void writeBinary(std::ostream& out) const;
+
+	/**
+	 * Replaces this hierarchy by one previously written with @ref writeBinary.
+	 */
+	void readBinary(std::istream& in);
 };
 
 template<class Matrix>
@@ -136,6 +246,82 @@ double LevelHierarchy<Matrix>::cycleIndex(index levelIdx) {
 	return gamma;
 }
 
+template<class Matrix>
+void LevelHierarchy<Matrix>::writeBinary(std::ostream& out) const {
+	using namespace LAMGBinaryIO;
+	writeMatrix(out, finestLevel.getLaplacian());
+	write<uint64_t>(out, levelType.size());
+	for (index k = 0; k < levelType.size(); ++k) {
+		write<uint8_t>(out, levelType[k]);
+		if (levelType[k] == ELIMINATION) {
+			const LevelElimination<Matrix>& level = eliminationLevels[levelIndex[k]];
+			writeMatrix(out, level.getLaplacian());
+			write<uint64_t>(out, level.getCoarseningStages().size());
+			for (const EliminationStage<Matrix>& stage : level.getCoarseningStages()) {
+				writeMatrix(out, stage.getP());
+				writeVector(out, stage.getQ());
+				writeArray(out, stage.getFSet());
+				writeArray(out, stage.getCSet());
+			}
+		} else {
+			const LevelAggregation<Matrix>& level = aggregationLevels[levelIndex[k]];
+			writeMatrix(out, level.getLaplacian());
+			writeMatrix(out, level.getP());
+			writeMatrix(out, level.getR());
+		}
+	}
+
+	count n = coarseLUMatrix.numberOfRows();
+	std::vector<double> entries(n * coarseLUMatrix.numberOfColumns());
+	for (index i = 0; i < n; ++i) {
+		for (index j = 0; j < coarseLUMatrix.numberOfColumns(); ++j) {
+			entries[i * coarseLUMatrix.numberOfColumns() + j] = coarseLUMatrix(i, j);
+		}
+	}
+	write<uint64_t>(out, n);
+	write<uint64_t>(out, coarseLUMatrix.numberOfColumns());
+	writeArray(out, entries);
+}
+
+template<class Matrix>
+void LevelHierarchy<Matrix>::readBinary(std::istream& in) {
+	using namespace LAMGBinaryIO;
+	*this = LevelHierarchy<Matrix>();
+	addFinestLevel(readMatrix<Matrix>(in));
+	count numLevels = read<uint64_t>(in);
+	for (index k = 0; k < numLevels; ++k) {
+		uint8_t type = read<uint8_t>(in);
+		if (type == ELIMINATION) {
+			Matrix A = readMatrix<Matrix>(in);
+			std::vector<EliminationStage<Matrix>> stages;
+			count numStages = read<uint64_t>(in);
+			for (index s = 0; s < numStages; ++s) {
+				Matrix P = readMatrix<Matrix>(in);
+				Vector q = readVector(in);
+				std::vector<index> fSet = readArray<index>(in);
+				std::vector<index> cSet = readArray<index>(in);
+				stages.push_back(EliminationStage<Matrix>(P, q, fSet, cSet));
+			}
+			addEliminationLevel(A, stages);
+		} else if (type == AGGREGATION) {
+			Matrix A = readMatrix<Matrix>(in);
+			Matrix P = readMatrix<Matrix>(in);
+			Matrix R = readMatrix<Matrix>(in);
+			addAggregationLevel(A, P, R);
+		} else {
+			throw std::runtime_error("unknown level type in LAMG hierarchy data");
+		}
+	}
+
+	count nRows = read<uint64_t>(in);
+	count nCols = read<uint64_t>(in);
+	std::vector<double> entries = readArray<double>(in);
+	if (entries.size() != nRows * nCols) {
+		throw std::runtime_error("corrupt coarse matrix in LAMG hierarchy data");
+	}
+	coarseLUMatrix = DenseMatrix(nRows, nCols, entries);
+}
+
 } /* namespace NetworKit */
 
 #endif /* LEVELHIERARCHY_H_ */
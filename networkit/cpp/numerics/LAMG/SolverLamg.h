@@ -141,7 +141,10 @@ void SolverLamg<Matrix>::solveCycle(Vector& x, const Vector& b, int finest, LAMG
 		rHistory[i] = std::vector<Vector>(MAX_COMBINED_ITERATES, Vector(hierarchy.at(i).getNumberOfNodes()));
 	}
 
-	Vector r = b - hierarchy.at(finest).getLaplacian() * x;
+	// r holds A*x - b, only its length is needed
+	Vector r;
+	hierarchy.at(finest).getLaplacian().multiply(x, r);
+	r -= b;
 	double residual = r.length();
 	double finalResidual = residual * status.desiredResidualReduction;
 	double bestResidual = std::numeric_limits<double>::max();
@@ -151,7 +154,8 @@ void SolverLamg<Matrix>::solveCycle(Vector& x, const Vector& b, int finest, LAMG
 	count noResReduction = 0;
 	while (residual > finalResidual && noResReduction < 5 && iterations < status.maxIters && timer.elapsedMilliseconds() <= status.maxConvergenceTime ) {
 		cycle(x, b, finest, coarsest, numVisits, X, B, status);
-		r = b - hierarchy.at(finest).getLaplacian() * x;
+		hierarchy.at(finest).getLaplacian().multiply(x, r);
+		r -= b;
 		residual = r.length();
 		status.residualHistory.emplace_back(residual);
 		if (residual < bestResidual) {
@@ -166,8 +170,8 @@ void SolverLamg<Matrix>::solveCycle(Vector& x, const Vector& b, int finest, LAMG
 	timer.stop();
 
 	status.numIters = iterations;
-	status.residual = r.length();
-	status.converged = r.length() <= finalResidual;
+	status.residual = residual;
+	status.converged = residual <= finalResidual;
 }
 
 template<class Matrix>
@@ -43,12 +43,23 @@ public:
 	 * Returns the preconditioned right-hand-side \f$P(b) = D(A)^{-1}b\f$.
 	 */
 	Vector rhs(const Vector& b) const {
-		assert(b.getDimension() == inv_diag.getDimension());
 		Vector out(b.getDimension());
+		rhs(b, out);
+		return out;
+	}
+
+	/**
+	 * Stores the preconditioned right-hand-side \f$P(b) = D(A)^{-1}b\f$ in @a out, reusing its memory.
+	 */
+	void rhs(const Vector& b, Vector& out) const {
+		assert(b.getDimension() == inv_diag.getDimension());
+		if (out.getDimension() != b.getDimension()) {
+			out = Vector(b.getDimension());
+		}
+#pragma omp parallel for
 		for (index i = 0; i < b.getDimension(); ++i) {
 			out[i] = inv_diag[i] * b[i];
 		}
-		return out;
 	}
 
 private:
@@ -31,6 +31,13 @@ public:
 	Vector rhs(const Vector& b) const {
 		return b;
 	}
+
+	/**
+	 * Stores the preconditioned right-hand-side \f$P(b) = b\f$ in @a out, reusing its memory.
+	 */
+	void rhs(const Vector& b, Vector& out) const {
+		out = b;
+	}
 };
 
 } /* namespace NetworKit */
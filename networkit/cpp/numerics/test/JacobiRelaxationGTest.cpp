@@ -0,0 +1,65 @@
+/*
+ * JacobiRelaxationGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "JacobiRelaxationGTest.h"
+
+#include "../GaussSeidelRelaxation.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+#include "../../auxiliary/Random.h"
+
+namespace NetworKit {
+
+TEST(JacobiRelaxationGTest, trySolve) {
+	std::vector<Triplet> triplets = {{0,0,10}, {0,1,-1}, {0,2,2}, {1,0,-1}, {1,1,11}, {1,2,-1}, {1,3,3}, {2,0,2}, {2,1,-1}, {2,2,10}, {2,3,-1}, {3,1,3}, {3,2,-1}, {3,3,8}};
+//	10  -1   2   0
+//	-1  11  -1   3
+//	 2  -1  10  -1
+//	 0   3  -1   8
+	CSRMatrix A(4, triplets);
+
+	Vector b = {6, 25, -11, 15};
+	Vector x = {0, 0, 0, 0};
+
+	JacobiRelaxation<CSRMatrix> solver(1.0);
+	Vector result = solver.relax(A, b, x);
+
+	EXPECT_EQ(1, std::round(result[0]));
+	EXPECT_EQ(2, std::round(result[1]));
+	EXPECT_EQ(-1, std::round(result[2]));
+	EXPECT_EQ(1, std::round(result[3]));
+	EXPECT_LE((A * result - b).length(), 1e-12 * b.length());
+}
+
+TEST(JacobiRelaxationGTest, trySmoothLaplacian) {
+	Graph G = ErdosRenyiGenerator(300, 0.05).generate();
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	// make the system positive definite so that both smoothers converge
+	for (index i = 0; i < G.numberOfNodes(); ++i) {
+		L.setValue(i, i, L(i, i) + 1.0);
+	}
+
+	Vector b(G.numberOfNodes());
+	for (index i = 0; i < b.getDimension(); ++i) {
+		b[i] = Aux::Random::real(-1.0, 1.0);
+	}
+
+	JacobiRelaxation<CSRMatrix> jacobi;
+	GaussSeidelRelaxation<CSRMatrix> gaussSeidel;
+	double initialResidual = b.length();
+
+	// a few sweeps reduce the residual and the result agrees with Gauss-Seidel after convergence
+	Vector smoothed = jacobi.relax(L, b, 5);
+	EXPECT_LT((L * smoothed - b).length(), initialResidual);
+
+	Vector x = JacobiRelaxation<CSRMatrix>(2.0/3.0, 1e-10).relax(L, b, 10000);
+	Vector y = GaussSeidelRelaxation<CSRMatrix>(1e-10).relax(L, b, 10000);
+	EXPECT_LE((L * x - b).length(), 1e-10 * b.length());
+	for (index i = 0; i < x.getDimension(); ++i) {
+		EXPECT_NEAR(y[i], x[i], 1e-8);
+	}
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,30 @@
+/*
+ * JacobiRelaxationGTest.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NOGTEST
+
+#ifndef JACOBIRELAXATIONGTEST_H_
+#define JACOBIRELAXATIONGTEST_H_
+
+#include "gtest/gtest.h"
+
+#include "../../algebraic/CSRMatrix.h"
+#include "../../algebraic/Vector.h"
+#include "../JacobiRelaxation.h"
+
+namespace NetworKit {
+
+class JacobiRelaxationGTest : public testing::Test {
+public:
+	JacobiRelaxationGTest() {}
+	~JacobiRelaxationGTest() {}
+};
+
+} /* namespace NetworKit */
+
+#endif /* JACOBIRELAXATIONGTEST_H_ */
+
+#endif
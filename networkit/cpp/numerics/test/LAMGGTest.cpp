@@ -8,11 +8,13 @@
 #include "LAMGGTest.h"
 #include "../LAMG/MultiLevelSetup.h"
 #include "../LAMG/SolverLamg.h"
+#include "../LAMG/Lamg.h"
 #include "../../io/LineFileReader.h"
 #include "../../auxiliary/Timer.h"
 #include "../../algebraic/CSRMatrix.h"
 
 #include "../GaussSeidelRelaxation.h"
+#include "../JacobiRelaxation.h"
 
 namespace NetworKit {
 
@@ -70,6 +72,119 @@ TEST_F(LAMGGTest, testSmallGraphs) {
 
 
 
+TEST_F(LAMGGTest, testParallelSolve) {
+	METISGraphReader reader;
+	Graph jazz = reader.read("input/jazz.graph");
+
+	// two disjoint copies of jazz plus an isolated node, so that every component gets its own hierarchy
+	count n = jazz.numberOfNodes();
+	Graph G(2 * n + 1);
+	jazz.forEdges([&](node u, node v) {
+		G.addEdge(u, v);
+		G.addEdge(n + u, n + v);
+	});
+
+	Lamg<CSRMatrix> lamg(1e-6);
+	lamg.setup(CSRMatrix::laplacianMatrix(G));
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+
+	const count k = 8;
+	std::vector<Vector> rhs(k);
+	std::vector<Vector> results(k, Vector(G.numberOfNodes()));
+	for (index i = 0; i < k; ++i) {
+		rhs[i] = randZeroSum(G, 12345 + i);
+	}
+
+	lamg.parallelSolve(rhs, results);
+
+	for (index i = 0; i < k; ++i) {
+		EXPECT_LE((L * results[i] - rhs[i]).length(), 1e-5 * rhs[i].length());
+
+		// same hierarchy, sequential solve
+		Vector x(G.numberOfNodes());
+		SolverStatus status = lamg.solve(rhs[i], x);
+		EXPECT_TRUE(status.converged);
+		EXPECT_LE((L * x - rhs[i]).length(), 1e-5 * rhs[i].length());
+	}
+
+	std::vector<Vector> tooFew(k - 1, Vector(G.numberOfNodes()));
+	EXPECT_THROW(lamg.parallelSolve(rhs, tooFew), std::runtime_error);
+}
+
+TEST_F(LAMGGTest, testJacobiSmoother) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/jazz.graph");
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+
+	Lamg<CSRMatrix, JacobiRelaxation<CSRMatrix>> lamg(1e-6);
+	lamg.setupConnected(L);
+
+	Vector b = randZeroSum(G, 4711);
+	Vector x(G.numberOfNodes());
+	SolverStatus status = lamg.solve(b, x);
+	EXPECT_TRUE(status.converged);
+	EXPECT_LE((L * x - b).length(), 1e-5 * b.length());
+}
+
+
+TEST_F(LAMGGTest, testSetupPersistenceAndCache) {
+	METISGraphReader reader;
+	Graph jazz = reader.read("input/jazz.graph");
+	count n = jazz.numberOfNodes();
+	Graph G(2 * n);
+	jazz.forEdges([&](node u, node v) {
+		G.addEdge(u, v);
+		G.addEdge(n + u, n + v);
+	});
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	Vector b = randZeroSum(G, 4242);
+
+	Lamg<CSRMatrix> lamg(1e-6);
+	lamg.setup(L);
+	Vector expected(G.numberOfNodes());
+	lamg.solve(b, expected);
+
+	// a hierarchy read from disk solves exactly like the one it was written from
+	lamg.saveSetup("output/lamgSetup.bin");
+	Lamg<CSRMatrix> loaded(1e-6);
+	loaded.loadSetup("output/lamgSetup.bin");
+	Vector x(G.numberOfNodes());
+	SolverStatus status = loaded.solve(b, x);
+	EXPECT_TRUE(status.converged);
+	for (index i = 0; i < x.getDimension(); ++i) {
+		EXPECT_NEAR(expected[i], x[i], 1e-12);
+	}
+
+	EXPECT_THROW(loaded.loadSetup("input/jazz.graph"), std::runtime_error);
+	EXPECT_THROW(Lamg<CSRMatrix>().saveSetup("output/lamgSetup.bin"), std::runtime_error);
+
+	// with the cache enabled the second setup of the same Laplacian reuses the first hierarchy
+	Lamg<CSRMatrix>::setSetupCacheCapacity(1);
+	Lamg<CSRMatrix> first(1e-6);
+	first.setup(L);
+	Lamg<CSRMatrix> second(1e-6);
+	second.setup(CSRMatrix::laplacianMatrix(G));
+	Vector x1(G.numberOfNodes());
+	Vector x2(G.numberOfNodes());
+	first.solve(b, x1);
+	second.solve(b, x2);
+	for (index i = 0; i < x1.getDimension(); ++i) {
+		EXPECT_NEAR(x1[i], x2[i], 1e-12);
+	}
+
+	// a different Laplacian must not hit the cache
+	Lamg<CSRMatrix> other(1e-6);
+	CSRMatrix jazzL = CSRMatrix::laplacianMatrix(jazz);
+	other.setup(jazzL);
+	Vector bJazz = randZeroSum(jazz, 7);
+	Vector xJazz(jazz.numberOfNodes());
+	EXPECT_TRUE(other.solve(bJazz, xJazz).converged);
+
+	Lamg<CSRMatrix>::clearSetupCache();
+	Lamg<CSRMatrix>::setSetupCacheCapacity(0);
+}
+
+
 Vector LAMGGTest::randVector(count dimension, double lower, double upper) const {
 	Vector randVector(dimension);
 	for (index i = 0; i < dimension; ++i) {
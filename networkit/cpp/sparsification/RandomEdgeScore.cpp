@@ -6,6 +6,7 @@
  */
 
 #include "RandomEdgeScore.h"
+#include "../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -18,10 +19,11 @@ void RandomEdgeScore::run() {
 	}
 	scoreData.resize(G.upperEdgeIdBound(), 0.0);
 
+	const uint64_t seed = Aux::Random::integer();
 	G.parallelForEdges([&](node u, node v, edgeid eid) {
 		//double r = Aux::Random::probability();
 		//scoreData[eid] = randomness * r + (1 - randomness) * attribute[eid];
-		scoreData[eid] = Aux::Random::probability();
+		scoreData[eid] = Aux::Random::SplitMix64(seed, eid).probability();
 	});
 	hasRun = true;
 }
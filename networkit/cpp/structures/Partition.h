@@ -282,6 +282,15 @@ public:
 	 */
 	std::vector<index> getVector() const;
 
+	/**
+	 * Get the vector representing the partition data structure without copying it. The reference
+	 * stays valid as long as no elements are added.
+	 * @return vector containing the subset of each element.
+	 */
+	inline const std::vector<index>& getVectorView() const {
+		return data;
+	}
+
 
 	/**
 	 * @return the subsets of the partition as a set of sets.
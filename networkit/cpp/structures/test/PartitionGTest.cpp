@@ -31,6 +31,15 @@ TEST_F(PartitionGTest, testVectorConstructor) {
 	EXPECT_EQ(1u ,p2.upperBound());
 }
 
+TEST_F(PartitionGTest, testVectorView) {
+	Partition p(10);
+	p.allToSingletons();
+	const std::vector<index>& view = p.getVectorView();
+	EXPECT_EQ(p.getVector(), view);
+	p.moveToSubset(p[3], 5);
+	EXPECT_EQ(p[3], view[5]);
+}
+
 
 TEST_F(PartitionGTest, testAllToSingletons) {
 	Partition p(10);
@@ -6,16 +6,19 @@
  */
 
 #include "FruchtermanReingold.h"
+#include "Octree.h"
 #include "../auxiliary/Log.h"
 
+#include <omp.h>
+
 namespace NetworKit {
 
 const float FruchtermanReingold::INITIAL_STEP_LENGTH = 1.0;
 const float FruchtermanReingold::OPT_PAIR_SQR_DIST_SCALE = 0.3;
 
 
-FruchtermanReingold::FruchtermanReingold(Point<float> bottom_left, Point<float> top_right, bool useGivenCoordinates, count maxIterations, float precision):
-		Layouter(bottom_left, top_right, useGivenCoordinates), maxIter(maxIterations), prec(precision), step(INITIAL_STEP_LENGTH)
+FruchtermanReingold::FruchtermanReingold(Point<float> bottom_left, Point<float> top_right, bool useGivenCoordinates, count maxIterations, float precision, double theta):
+		Layouter(bottom_left, top_right, useGivenCoordinates), maxIter(maxIterations), prec(precision), step(INITIAL_STEP_LENGTH), theta(theta)
 {
 
 }
@@ -109,6 +112,12 @@ void FruchtermanReingold::draw(Graph& g) {
 	bool converged = false;
 	std::vector<float> origin = {0.0, 0.0};
 	std::vector<Point<float> > forces(n, origin);
+	bool barnesHut = (theta > 0 && n > 1);
+	std::vector<std::vector<Point<float> > > threadForces;
+	if (!barnesHut) {
+		// per-thread buffers so that the pairwise forces can be applied to both nodes
+		threadForces.resize(omp_get_max_threads(), forces);
+	}
 	float actualStep = INITIAL_STEP_LENGTH;
 	count iter = 0;
 
@@ -124,17 +133,54 @@ void FruchtermanReingold::draw(Graph& g) {
 		});
 
 		// repulsive forces
-		g.parallelForNodePairs([&](node u, node v) {
-			Point<float> force = repulsiveForce(previousLayout[u], previousLayout[v]);
-			forces[u] += force;
-			forces[v] -= force;
-		});
+		if (barnesHut) {
+			std::vector<Vector> coordinates(2, Vector(n));
+			index i = 0;
+			g.forNodes([&](node u) {
+				coordinates[0][i] = previousLayout[u][0];
+				coordinates[1][i] = previousLayout[u][1];
+				++i;
+			});
+			Octree<double> octree(coordinates);
+
+			g.parallelForNodes([&](node u) {
+				Point<double> p(previousLayout[u][0], previousLayout[u][1]);
+				auto repulseFrom([&](const count weight, const Point<double>& centerOfMass, const double sqDist) {
+					if (sqDist > 0) {
+						float strength = weight * optPairSqrDist / sqDist;
+						forces[u][0] += strength * (p[0] - centerOfMass[0]);
+						forces[u][1] += strength * (p[1] - centerOfMass[1]);
+					}
+				});
+				octree.approximateDistance(p, theta, repulseFrom);
+			});
+		} else {
+			g.parallelForNodePairs([&](node u, node v) {
+				std::vector<Point<float> >& local = threadForces[omp_get_thread_num()];
+				Point<float> force = repulsiveForce(previousLayout[u], previousLayout[v]);
+				local[u] += force;
+				local[v] -= force;
+			});
+
+			g.parallelForNodes([&](node u) {
+				for (std::vector<Point<float> >& local : threadForces) {
+					forces[u] += local[u];
+					local[u] = origin;
+				}
+			});
+		}
 
 		// attractive forces
-		g.parallelForEdges([&](node u, node v) {
-			Point<float> attr = attractiveForce(previousLayout[u], previousLayout[v]);
-			forces[u] -= attr;
-			forces[v] += attr;
+		g.parallelForNodes([&](node u) {
+			auto attract([&](node v) {
+				if (u != v) {
+					forces[u] -= attractiveForce(previousLayout[u], previousLayout[v]);
+				}
+			});
+			g.forNeighborsOf(u, attract);
+			if (g.isDirected()) {
+				g.forInNeighborsOf(u, attract);
+			}
 		});
 
 
@@ -36,6 +36,7 @@ private:
 	count maxIter;
 	float prec;
 	float step;
+	double theta;
 
 public:
 
@@ -49,8 +50,14 @@ public:
 	 * Constructor.
 	 * @param[in] bottomLeft Coordinate of point in bottom/left corner
 	 * @param[in] topRight Coordinate of point in top/right corner
+	 * @param[in] useGivenCoordinates Whether the current coordinates of the graph are used as starting layout
+	 * @param[in] maxIterations Maximum number of iterations
+	 * @param[in] precision Convergence threshold for the total movement of one iteration
+	 * @param[in] theta Opening angle of the Barnes-Hut approximation of the repulsive forces.
+	 * If theta is 0 (default), all pairs of nodes are considered, which takes O(n^2) time per iteration.
+	 * Otherwise each iteration takes O(n log n) time; values around 0.6 are a good trade-off.
 	 */
-	FruchtermanReingold(Point<float> bottomLeft, Point<float> topRight, bool useGivenCoordinates = false, count maxIterations = MAX_ITER, float precision = EPS);
+	FruchtermanReingold(Point<float> bottomLeft, Point<float> topRight, bool useGivenCoordinates = false, count maxIterations = MAX_ITER, float precision = EPS, double theta = 0.0);
 
 	/**
 	 * Assigns coordinates to vertices in graph @a g
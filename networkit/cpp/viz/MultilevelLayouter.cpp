@@ -8,6 +8,7 @@
 #include "MultilevelLayouter.h"
 #include "FruchtermanReingold.h"
 #include "MaxentStress.h"
+#include "PostscriptWriter.h"
 #include "../community/PLP.h"
 #include "../io/METISGraphWriter.h"
 #include "../community/EdgeCut.h"
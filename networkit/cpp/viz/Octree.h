@@ -98,9 +98,10 @@ struct OctreeNode {
 	}
 
 	void computeCenterOfMass() {
-		if (!isLeaf()) {
+		if (weight > 1) {
 			centerOfMass.scale(1.0/(double) weight);
-
+		}
+		if (!isLeaf()) {
 			// remove empty childs
 			children.erase(std::remove_if(children.begin(), children.end(), [&](OctreeNode<T>& child){return child.isEmpty();}), children.end());
 
@@ -168,15 +169,19 @@ struct OctreeNode {
 			centerOfMass = point;
 		} else {
 			if (isLeaf()) { // split the leaf!
-				if (point.distance(centerOfMass) < 1e-3) {
+				// leaves store the sum of their (nearly coinciding) points until computeCenterOfMass is called
+				Point<T> leafPoint = centerOfMass;
+				leafPoint.scale(1.0/(double) weight);
+				if (point.distance(leafPoint) < 1e-3) {
 					centerOfMass += point;
 					weight++;
 					return;
 				}
 				split(dimensions, numChildrenPerNode);
-				for (auto &child : children) { // add leaf point to one of this node's new children
-					if (child.contains(centerOfMass)) {
-						child.addPoint(centerOfMass, dimensions, numChildrenPerNode);
+				for (auto &child : children) { // move leaf points to one of this node's new children
+					if (child.contains(leafPoint)) {
+						child.weight = weight;
+						child.centerOfMass = centerOfMass;
 						break;
 					}
 				}
@@ -81,4 +81,31 @@ TEST(OctreeGTest, testOctreeWithExample) {
 
 }
 
+TEST(OctreeGTest, testCoincidingPoints) {
+	std::vector<Vector> coordinates(2, Vector(4, 0.0));
+	coordinates[0][0] = 1.0;
+	coordinates[1][0] = 1.0;
+
+	coordinates[0][1] = 1.0;
+	coordinates[1][1] = 1.0;
+
+	coordinates[0][2] = 1.0;
+	coordinates[1][2] = 1.0;
+
+	coordinates[0][3] = 5.0;
+	coordinates[1][3] = 3.0;
+
+	Octree<double> ocTree(coordinates);
+	std::vector<std::pair<count, Point<double>>> exact = ocTree.approximateDistance(Point<double>(0.0, 0.0), 0.0);
+	ASSERT_EQ(exact.size(), 2u);
+	for (auto &point : exact) {
+		if (point.first == 3) {
+			EXPECT_EQ(point.second, Point<double>(1.0, 1.0));
+		} else {
+			EXPECT_EQ(point.first, 1u);
+			EXPECT_EQ(point.second, Point<double>(5.0, 3.0));
+		}
+	}
+}
+
 } /* namespace NetworKit */
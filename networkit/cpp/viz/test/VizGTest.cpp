@@ -111,6 +111,37 @@ TEST_F(VizGTest, testFRLayouter) {
  	EXPECT_LE(avg, 0.25);
 }
 
+TEST_F(VizGTest, testFRLayouterBarnesHut) {
+ 	count n = 2000;
+ 	count numClusters = 8;
+ 	double pin = 0.02;
+ 	double pout = 0.0001;
+
+	ClusteredRandomGraphGenerator graphGen(n, numClusters, pin, pout);
+	Graph G = graphGen.generate();
+ 	G.initCoordinates();
+
+ 	Point<float> bl(0.0, 0.0);
+ 	Point<float> tr(1.0, 1.0);
+
+ 	FruchtermanReingold fdLayouter(bl, tr, false, 50, EPS, 0.6);
+ 	fdLayouter.draw(G);
+
+ 	G.forNodes([&](node u) {
+ 		Point<float> p = G.getCoordinate(u);
+ 		EXPECT_GE(p[0], 0.0);
+ 		EXPECT_LE(p[0], 1.0);
+ 		EXPECT_GE(p[1], 0.0);
+ 		EXPECT_LE(p[1], 1.0);
+ 	});
+
+ 	// test edge distances
+ 	float dist = edgeDistanceSum(G);
+ 	float avg = dist / (float) G.numberOfEdges();
+ 	INFO("avg edge length: ", avg);
+ 	EXPECT_LE(avg, 0.25);
+}
+
  TEST_F(VizGTest, tryMultilevelLayouter) {
   	// create graph
   	count n = 300;
@@ -1,2 +1,2 @@
-from _NetworKit import AdamicAdarDistance, Diameter, Eccentricity, EffectiveDiameter, EffectiveDiameterApproximation, HopPlotApproximation, JaccardDistance, AlgebraicDistance, NeighborhoodFunction, NeighborhoodFunctionApproximation, CommuteTimeDistance, NeighborhoodFunctionHeuristic
+from _NetworKit import AdamicAdarDistance, Diameter, Eccentricity, EccentricityBounding, EffectiveDiameter, EffectiveDiameterApproximation, HopPlotApproximation, JaccardDistance, AlgebraicDistance, NeighborhoodFunction, NeighborhoodFunctionApproximation, HyperANF, CommuteTimeDistance, NeighborhoodFunctionHeuristic, EffectiveResistanceSketch
 from _NetworKit import _DiameterAlgo as DiameterAlgo